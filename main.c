@@ -41,9 +41,11 @@ Copyright (c) [2012-2020] Microchip Technology Inc.
 int main(void)
 {
     SYSTEM_Initialize();
+    cpu_irq_enable();
     DIAG_SRAM_MarchB_Example();
 
     while (1)
     {
+        SCHEDULER_RunOnce();
     }
 }
\ No newline at end of file
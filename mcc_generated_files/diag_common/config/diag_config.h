@@ -27,8 +27,37 @@
 #ifndef DIAG_CONFIG_H
 #define DIAG_CONFIG_H
 
+#include "../../include/watchdog.h"
+
 
 #define MARCH_BUFFER_OFFSET (INTERNAL_SRAM_START)
 #define CHECKERBOARD_BUFFER_OFFSET (INTERNAL_SRAM_START + 16)
 
+#define FLASH_CRC_START_ADDRESS (0x00000UL)
+#define FLASH_CRC_END_ADDRESS (FLASH_APPDATA_START)
+#define FLASH_CRC_SLICE_SIZE (64U)
+#define FLASH_CRC_REFERENCE_EEPROM_ADDRESS (EEPROM_SIZE - 4U)
+#define DIAG_FLASH_CRC32 (0)
+#define DIAG_FLASH_CRCSCAN_ON_STARTUP (0)
+
+#define DIAG_CLOCK_PPM_WINDOW (20000L)
+#define DIAG_CLOCK_XOSC32K_TIMEOUT_US (3000000UL)
+#define DIAG_CLOCK_CAPTURE_TIMEOUT_PERIODS (4U)
+#define DIAG_CLOCK_EVSYS_CHANNEL (EVSYS.CHANNEL0)
+#define DIAG_CLOCK_EVSYS_USER (EVSYS_USER_CHANNEL0_gc)
+
+/*
+ Called between slices of the long memory tests, at most FLASH_CRC_SLICE_SIZE
+ flash bytes or one SRAM_SEC_SIZE section apart. Keeps the watchdog fed while
+ the tests hold up the application; define empty to run them unsupervised.
+ */
+#define DIAG_SLICE_HOOK() WATCHDOG_Poll()
+
+/*
+ Watchdog period while the startup tests run, normal mode as the timebase is
+ not running before main(). Must cover one slice plus the start-up code up to
+ WATCHDOG_Initialize().
+ */
+#define DIAG_WDT_STARTUP_PERIOD (WDT_PERIOD_256CLK_gc)
+
 #endif //DIAG_CONFIG_H
\ No newline at end of file
@@ -24,7 +24,11 @@
  *
  */
 
+#include <xc.h>
+#include "../config/diag_config.h"
 #include "../../diag_library/memory/volatile/diag_sram_marchb.h"
+#include "../../diag_library/memory/non_volatile/diag_flash_crc.h"
+#include "../../include/diag_cpu_registers.h"
 /**
  @def DIAG_CPU_INIT1_SECTION
  This macro is used to define the attributes used to place a function in .init1 section
@@ -40,5 +44,20 @@
 */
 void INIT1_SECTION DIAG_OnStartup(void)
 {
+    //The other tests rely on the CPU registers, a failure does not return
+    DIAG_CPU_RegistersStartup();
+
+    //Supervise the tests, WATCHDOG_Initialize() takes over the watchdog in main()
+    WATCHDOG_Enable(DIAG_WDT_STARTUP_PERIOD, WDT_WINDOW_OFF_gc);
+
     DIAG_SRAM_MarchB();
+#if DIAG_FLASH_CRCSCAN_ON_STARTUP
+    DIAG_FLASH_CRCScan();
+#endif
+
+#if WATCHDOG_ENABLE
+    DIAG_SLICE_HOOK();
+#else
+    WATCHDOG_Enable(WDT_PERIOD_OFF_gc, WDT_WINDOW_OFF_gc);
+#endif
 }
@@ -25,21 +25,28 @@
  */
 
 #include <stdint.h>
-#include <stdio.h>
 #include <xc.h>
 #include "diag_common_example.h"
+#include "../../include/format.h"
+#include "../../include/telemetry.h"
+#include "../../include/event_log.h"
+#include "../../include/timebase.h"
+#include "../../include/usart1.h"
 #include "../../diag_library/memory/volatile/diag_sram_marchb.h"
 #include "../../diag_library/memory/volatile/diag_sram_checkerboard.h"
+#include "../../diag_library/memory/non_volatile/diag_flash_crc.h"
+#include "../../diag_library/clock/diag_clock_freq.h"
+#include "../../include/diag_cpu_registers.h"
 
 void DIAG_SRAM_MarchB_Example(void)
 {
     if (SRAM_OK == DIAG_SRAM_MarchB_GetStatus())
     {
-        printf("\r\nPassed : SRAM March-B test\r\n");
+        FMT_PUTS("\r\nPassed : SRAM March-B test\r\n");
     }
     else
     {
-        printf("\r\nFailed : SRAM March-B test\r\n");
+        FMT_PUTS("\r\nFailed : SRAM March-B test\r\n");
     }
 }
 
@@ -47,14 +54,90 @@ void DIAG_SRAM_CheckerBoard_Example(void)
 {
     if (SRAM_OK == DIAG_SRAM_CheckerBoard((uint8_t*) INTERNAL_SRAM_START, INTERNAL_SRAM_SIZE))
     {
-        printf("\r\nPassed : SRAM Checkerboard test\r\n");
+        FMT_PUTS("\r\nPassed : SRAM Checkerboard test\r\n");
     }
     else
     {
-        printf("\r\nFailed : SRAM Checkerboard test\r\n");
+        FMT_PUTS("\r\nFailed : SRAM Checkerboard test\r\n");
     }
 }
 
+void DIAG_FLASH_CRC_Example(void)
+{
+    diag_flash_status_t status;
+
+    DIAG_FLASH_CRC_Initialize();
+
+    do
+    {
+        status = DIAG_FLASH_CRC_Step();
+    }
+    while (FLASH_CRC_IN_PROGRESS == status);
+
+    if (FLASH_CRC_OK == status)
+    {
+        FMT_PUTS("\r\nPassed : Flash CRC test\r\n");
+    }
+    else
+    {
+        FMT_PUTS("\r\nFailed : Flash CRC test\r\n");
+    }
+}
+
+void DIAG_CPU_Registers_Example(void)
+{
+    diag_cpu_status_t status;
+
+    do
+    {
+        status = DIAG_CPU_Registers_Step();
+    }
+    while (CPU_REGISTERS_IN_PROGRESS == status);
+
+    if (CPU_REGISTERS_OK == status)
+    {
+        FMT_PUTS("\r\nPassed : CPU register test\r\n");
+    }
+    else
+    {
+        FMT_PUTS("\r\nFailed : CPU register test\r\n");
+    }
+}
+
+void DIAG_CLOCK_Example(void)
+{
+    diag_clock_status_t status = DIAG_CLOCK_Initialize();
+
+    while (CLOCK_IN_PROGRESS == status)
+    {
+        status = DIAG_CLOCK_Poll();
+    }
+
+    if (CLOCK_OK == status)
+    {
+        FMT_PUTS("\r\nPassed : Clock test, ");
+        FMT_PutSigned(DIAG_CLOCK_GetDeviation());
+        FMT_PUTS(" ppm\r\n");
+    }
+    else
+    {
+        FMT_PUTS("\r\nFailed : Clock test\r\n");
+    }
+}
+
+void DIAG_TELEMETRY_Example(void)
+{
+    /* Boot stage 0: main reached, ticks since the timebase started */
+    TELEMETRY_SendBootTime(0, TIMEBASE_Now());
+
+    TELEMETRY_SendDiag(TELEMETRY_TEST_SRAM_MARCHB, DIAG_SRAM_MarchB_GetStatus(), 0);
+
+    TELEMETRY_SendCounter(TELEMETRY_COUNTER_TX_DROPPED, USART1_GetTxDropCount());
+    TELEMETRY_SendCounter(TELEMETRY_COUNTER_RX_DROPPED, USART1_GetRxDropCount());
+    TELEMETRY_SendCounter(TELEMETRY_COUNTER_FRAMES_DROPPED, TELEMETRY_GetDropCount());
+    TELEMETRY_SendCounter(TELEMETRY_COUNTER_EVENT_LOG, EVENT_LOG_GetSequence());
+}
+
 /**
 End of File
  */
\ No newline at end of file
@@ -29,6 +29,10 @@
 
 void DIAG_SRAM_MarchB_Example(void);
 void DIAG_SRAM_CheckerBoard_Example(void);
+void DIAG_FLASH_CRC_Example(void);
+void DIAG_CPU_Registers_Example(void);
+void DIAG_CLOCK_Example(void);
+void DIAG_TELEMETRY_Example(void);
 
 #endif /* DIAG_COMMON_EXAMPLE_H */
 /**
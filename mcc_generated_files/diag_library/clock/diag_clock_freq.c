@@ -0,0 +1,199 @@
+/**
+ *  (c) 2020 Microchip Technology Inc. and its subsidiaries.
+ *
+ *  Subject to your compliance with these terms, you may use Microchip software
+ *  and any derivatives exclusively with Microchip products. You're responsible
+ *  for complying with 3rd party license terms applicable to your use of 3rd
+ *  party software (including open source software) that may accompany Microchip
+ *  software.
+ *
+ *  SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ *  APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+ *  MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *  IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ *  INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ *  WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP
+ *  HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO
+ *  THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL
+ *  CLAIMS RELATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF FEES, IF ANY,
+ *
+ *  @file    diag_clock_freq.c
+ *  @brief   This file contains APIs to monitor the main clock against the 32.768 kHz crystal
+ *
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "diag_clock_freq.h"
+#include "../../diag_common/config/diag_config.h"
+#include "../../include/ccp.h"
+#include "../../include/clock_manager.h"
+#include "../../include/timebase.h"
+#include "../../include/utils/utils_assert.h"
+
+/**
+ @ingroup diag_clock_freq
+ @def DIAG_CLOCK_RTC_FREQUENCY
+ Frequency of the reference clock
+ */
+#define DIAG_CLOCK_RTC_FREQUENCY (32768UL)
+
+/**
+ @ingroup diag_clock_freq
+ @def DIAG_CLOCK_MAX_COUNT
+ Largest count TCB2 can capture
+ */
+#define DIAG_CLOCK_MAX_COUNT (65535UL)
+
+/**
+ @ingroup diag_clock_freq
+ @def DIAG_CLOCK_MAX_DIFF
+ Largest count difference evaluated, larger ones are clamped so the ppm computation cannot overflow
+ */
+#define DIAG_CLOCK_MAX_DIFF (2000L)
+
+/**
+ @ingroup diag_clock_freq
+ @def DIAG_CLOCK_XOSC32K_STARTUP_US
+ Start-up time counted by CLKCTRL_CSUT_64K_gc, 64k crystal cycles
+ */
+#define DIAG_CLOCK_XOSC32K_STARTUP_US ((65536UL * 1000000UL) / DIAG_CLOCK_RTC_FREQUENCY)
+
+STATIC_ASSERT(DIAG_CLOCK_XOSC32K_TIMEOUT_US > DIAG_CLOCK_XOSC32K_STARTUP_US, xosc32k_timeout_shorter_than_startup);
+STATIC_ASSERT(DIAG_CLOCK_CAPTURE_TIMEOUT_PERIODS >= 2, capture_timeout_too_short);
+
+static volatile __persistent diag_clock_status_t diag_clock_state;
+
+static int32_t diag_clock_deviation;
+
+/** Expected TCB2 count per RTC period at the current frequency */
+static uint16_t diag_clock_expected;
+
+/** The next capture spans a period change and must be discarded */
+static volatile bool diag_clock_discard;
+
+/** Timestamp of the last capture, or of the last period change */
+static volatile timebase_t diag_clock_last_capture;
+
+static void DIAG_CLOCK_SetWindow(uint32_t frequency)
+{
+    //Size the period for the fastest clock still inside the window, so an in-window capture cannot wrap
+    uint32_t fastest = frequency + (((frequency / 1000UL) * (uint32_t)DIAG_CLOCK_PPM_WINDOW) / 1000UL);
+    uint16_t ticks = (uint16_t)((DIAG_CLOCK_MAX_COUNT * DIAG_CLOCK_RTC_FREQUENCY) / fastest);
+
+    diag_clock_expected = (uint16_t)((frequency * ticks) / DIAG_CLOCK_RTC_FREQUENCY);
+    diag_clock_discard = true;
+    diag_clock_last_capture = TIMEBASE_Now();
+
+    while (RTC.STATUS & RTC_PERBUSY_bm)
+    {
+    }
+    RTC.PER = ticks - 1;
+}
+
+diag_clock_status_t DIAG_CLOCK_Initialize(void)
+{
+    timebase_t timeout = TIMEBASE_UsToTicks(DIAG_CLOCK_XOSC32K_TIMEOUT_US);
+    timebase_t start = TIMEBASE_Now();
+
+    diag_clock_state = CLOCK_IN_PROGRESS;
+
+    //RUNSTDBY enabled; CSUT 64k cycles; SEL crystal; LPMODE disabled; ENABLE enabled;
+    CCP_WRITE_IO(CLKCTRL.XOSC32KCTRLA, CLKCTRL_RUNSTDBY_bm | CLKCTRL_CSUT_64K_gc | CLKCTRL_ENABLE_bm);
+
+    while (!(CLKCTRL.MCLKSTATUS & CLKCTRL_XOSC32KS_bm))
+    {
+        if (TIMEBASE_ELAPSED(start, TIMEBASE_Now()) > timeout)
+        {
+            diag_clock_state = CLOCK_ERROR;
+            return diag_clock_state;
+        }
+        //The start-up takes longer than the watchdog period
+        DIAG_SLICE_HOOK();
+    }
+
+    //AUTOTUNE enabled, OSCHF is tuned against XOSC32K;
+    CCP_WRITE_IO(CLKCTRL.OSCHFCTRLA, CLKCTRL.OSCHFCTRLA | CLKCTRL_AUTOTUNE_bm);
+
+    while (RTC.STATUS)
+    {
+    }
+    RTC.CLKSEL = RTC_CLKSEL_XOSC32K_gc;
+    DIAG_CLOCK_SetWindow(CLOCK_GetFrequency());
+    while (RTC.STATUS)
+    {
+    }
+    RTC.CTRLA = RTC_PRESCALER_DIV1_gc | RTC_RTCEN_bm;
+
+    DIAG_CLOCK_EVSYS_CHANNEL = EVSYS_CHANNEL0_RTC_OVF_gc;
+    EVSYS.USERTCB2CAPT = DIAG_CLOCK_EVSYS_USER;
+
+    TCB2.CTRLB = TCB_CNTMODE_FRQ_gc;
+    TCB2.EVCTRL = TCB_CAPTEI_bm;
+    TCB2.INTFLAGS = TCB_CAPT_bm;
+    TCB2.CTRLA = TCB_CLKSEL_DIV1_gc | TCB_ENABLE_bm;
+
+    CLOCK_RegisterConsumer(DIAG_CLOCK_SetWindow);
+
+    return diag_clock_state;
+}
+
+diag_clock_status_t DIAG_CLOCK_Poll(void)
+{
+    int32_t diff;
+    timebase_t now = TIMEBASE_Now();
+
+    if (!(TCB2.INTFLAGS & TCB_CAPT_bm))
+    {
+        //The count per RTC period is in CLK_PER cycles, which are timebase ticks
+        if (TIMEBASE_ELAPSED(diag_clock_last_capture, now) >
+                (timebase_t)diag_clock_expected * DIAG_CLOCK_CAPTURE_TIMEOUT_PERIODS)
+        {
+            diag_clock_state = CLOCK_ERROR;
+            return diag_clock_state;
+        }
+        return CLOCK_IN_PROGRESS;
+    }
+
+    //Reading CCMP clears the capture flag
+    diff = (int32_t)TCB2.CCMP - (int32_t)diag_clock_expected;
+    diag_clock_last_capture = now;
+
+    if (diag_clock_discard)
+    {
+        diag_clock_discard = false;
+        return CLOCK_IN_PROGRESS;
+    }
+
+    if (diff > DIAG_CLOCK_MAX_DIFF)
+    {
+        diff = DIAG_CLOCK_MAX_DIFF;
+    }
+    else if (diff < -DIAG_CLOCK_MAX_DIFF)
+    {
+        diff = -DIAG_CLOCK_MAX_DIFF;
+    }
+    diag_clock_deviation = (diff * 1000000L) / (int32_t)diag_clock_expected;
+
+    if ((diag_clock_deviation > DIAG_CLOCK_PPM_WINDOW) || (diag_clock_deviation < -DIAG_CLOCK_PPM_WINDOW))
+    {
+        diag_clock_state = CLOCK_ERROR;
+    }
+    else
+    {
+        diag_clock_state = CLOCK_OK;
+    }
+
+    return diag_clock_state;
+}
+
+int32_t DIAG_CLOCK_GetDeviation(void)
+{
+    return diag_clock_deviation;
+}
+
+diag_clock_status_t DIAG_CLOCK_GetStatus(void)
+{
+    return diag_clock_state;
+}
@@ -0,0 +1,99 @@
+/**
+ *  (c) 2020 Microchip Technology Inc. and its subsidiaries.
+ *
+ *  Subject to your compliance with these terms, you may use Microchip software
+ *  and any derivatives exclusively with Microchip products. You're responsible
+ *  for complying with 3rd party license terms applicable to your use of 3rd
+ *  party software (including open source software) that may accompany Microchip
+ *  software.
+ *
+ *  SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ *  APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+ *  MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *  IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ *  INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ *  WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP
+ *  HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO
+ *  THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL
+ *  CLAIMS RELATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF FEES, IF ANY,
+ *
+ *  @file    diag_clock_freq.h
+ *  @brief   This file contains API prototypes for the main clock frequency test
+ *
+ */
+
+#ifndef DIAG_CLOCK_FREQ_H
+#define DIAG_CLOCK_FREQ_H
+
+/**
+ * @brief This module contains functional safety diagnostics APIs for the main clock
+ * @defgroup diag_clock_freq Clock - Frequency monitor
+ * @{
+ */
+
+#include "diag_clock_types.h"
+#include <stdint.h>
+#include <xc.h>
+
+/**
+ @ingroup diag_clock_freq
+ @brief This API starts the 32.768 kHz crystal, enables OSCHF autotune and starts the monitor.
+
+ The RTC is clocked from XOSC32K and its overflow event is routed through event channel
+ DIAG_CLOCK_EVSYS_CHANNEL to TCB2 in frequency measurement mode. TCB2 counts CLK_PER
+ between two RTC overflows, which gives the main clock against the crystal.
+ The RTC period is chosen so that the count stays below 65536 for a clock running fast by
+ up to DIAG_CLOCK_PPM_WINDOW, giving a resolution of about 15 ppm at 24 MHz. The period is
+ recomputed when the clock manager changes the frequency.
+
+ The timebase must be running. If the crystal does not start within
+ DIAG_CLOCK_XOSC32K_TIMEOUT_US, which must exceed the 2 s CSUT start-up time, the status
+ becomes @ref CLOCK_ERROR.
+
+ Error reporting: \n
+     @ref DIAG_CLOCK_GetStatus() should be called from main() to know
+     the status of the clock test
+
+ @return @ref CLOCK_IN_PROGRESS \n
+ @ref CLOCK_ERROR \n
+ */
+diag_clock_status_t DIAG_CLOCK_Initialize(void);
+
+/**
+ @ingroup diag_clock_freq
+ @brief This API evaluates the latest capture of the clock monitor.
+
+ Meant to be called periodically. It returns immediately when no new capture is available.
+ A capture whose deviation lies outside +/- DIAG_CLOCK_PPM_WINDOW sets the clock fault status,
+ which stays set until the next in-window measurement. So does the lack of any capture for
+ DIAG_CLOCK_CAPTURE_TIMEOUT_PERIODS RTC periods, as when the crystal or the RTC has stopped.
+
+ @return @ref CLOCK_IN_PROGRESS if no new capture is available yet \n
+ @ref CLOCK_OK \n
+ @ref CLOCK_ERROR \n
+ */
+diag_clock_status_t DIAG_CLOCK_Poll(void);
+
+/**
+ @ingroup diag_clock_freq
+ @brief This API returns the deviation of the last measurement in ppm
+
+ @return Positive when the main clock runs fast
+*/
+int32_t DIAG_CLOCK_GetDeviation(void);
+
+/**
+ @ingroup diag_clock_freq
+ @brief This API returns the status of the clock test
+
+ @return @ref CLOCK_IN_PROGRESS \n
+ @ref CLOCK_OK \n
+ @ref CLOCK_ERROR \n
+*/
+diag_clock_status_t DIAG_CLOCK_GetStatus(void);
+
+/**
+ * @}
+ */
+#endif //DIAG_CLOCK_FREQ_H
@@ -0,0 +1,46 @@
+/**
+ *  (c) 2020 Microchip Technology Inc. and its subsidiaries.
+ *
+ *  Subject to your compliance with these terms, you may use Microchip software
+ *  and any derivatives exclusively with Microchip products. You're responsible
+ *  for complying with 3rd party license terms applicable to your use of 3rd
+ *  party software (including open source software) that may accompany Microchip
+ *  software.
+ *
+ *  SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ *  APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+ *  MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *  IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ *  INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ *  WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP
+ *  HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO
+ *  THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL
+ *  CLAIMS RELATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF FEES, IF ANY,
+ *
+ *  @file    diag_clock_types.h
+ *  @brief   This file contains common type definitions for clock diagnostics module
+ *
+ */
+
+#ifndef DIAG_CLOCK_TYPES_H
+#define DIAG_CLOCK_TYPES_H
+
+/**
+ @enum diag_clock_status_t
+ @brief This enumeration contains return codes for clock diagnostics tests
+ @var diag_clock_status_t:: CLOCK_OK
+ 0 - indicates that the main clock is within the configured window \n
+ @var diag_clock_status_t:: CLOCK_ERROR
+ 1 - indicates a clock fault: the main clock left the window or the reference failed \n
+ @var diag_clock_status_t:: CLOCK_IN_PROGRESS
+ 2 - indicates that no measurement has completed yet \n
+ */
+typedef enum
+{
+    CLOCK_OK = 0,
+    CLOCK_ERROR = 1,
+    CLOCK_IN_PROGRESS = 2
+} diag_clock_status_t;
+
+#endif //DIAG_CLOCK_TYPES_H
@@ -0,0 +1,201 @@
+/**
+ *  (c) 2020 Microchip Technology Inc. and its subsidiaries.
+ *
+ *  Subject to your compliance with these terms, you may use Microchip software
+ *  and any derivatives exclusively with Microchip products. You're responsible
+ *  for complying with 3rd party license terms applicable to your use of 3rd
+ *  party software (including open source software) that may accompany Microchip
+ *  software.
+ *
+ *  SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ *  APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+ *  MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *  IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ *  INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ *  WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP
+ *  HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO
+ *  THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL
+ *  CLAIMS RELATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF FEES, IF ANY,
+ *
+ *  @file    diag_flash_crc.c
+ *  @brief   This file contains APIs to test Flash using CRC
+ *
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <avr/pgmspace.h>
+#include "diag_flash_crc.h"
+#include "../../../diag_common/config/diag_config.h"
+#include "../../../include/crc.h"
+#include "../../../include/nvmctrl.h"
+#include "../../../include/utils/utils_assert.h"
+
+#if DIAG_FLASH_CRC32
+typedef uint32_t diag_flash_crc_t;
+#define DIAG_FLASH_CRC_INITIAL          CRC32_INITIAL
+#define DIAG_FLASH_CRC_UPDATE(crc, d)   CRC32_UpdateByte((crc), (d))
+#define DIAG_FLASH_CRC_FINAL(crc)       CRC32_FINAL(crc)
+#else
+typedef uint16_t diag_flash_crc_t;
+#define DIAG_FLASH_CRC_INITIAL          CRC16_INITIAL
+#define DIAG_FLASH_CRC_UPDATE(crc, d)   CRC16_UpdateByte((crc), (d))
+#define DIAG_FLASH_CRC_FINAL(crc)       (crc)
+#endif
+
+/**
+ @ingroup diag_flash_crc
+ @def DIAG_FLASH_CRC_CHECK
+ Check word stored next to the persistent cursor and partial CRC
+ */
+#define DIAG_FLASH_CRC_CHECK(cursor, crc) (~((uint32_t)(cursor) ^ (uint32_t)(crc)))
+
+STATIC_ASSERT(FLASH_CRC_SLICE_SIZE > 0, flash_crc_slice_empty);
+STATIC_ASSERT(FLASH_CRC_START_ADDRESS < FLASH_CRC_END_ADDRESS, flash_crc_range_empty);
+STATIC_ASSERT(FLASH_CRC_END_ADDRESS <= PROGMEM_SIZE, flash_crc_range_outside_flash);
+STATIC_ASSERT_NO_OVERLAP(FLASH_CRC_START_ADDRESS, FLASH_CRC_END_ADDRESS - FLASH_CRC_START_ADDRESS, FLASH_APPDATA_START, FLASH_APPDATA_SIZE, flash_crc_range_overlaps_appdata);
+/* The hexmate range of the CRCSCAN checksum in nbproject/configurations.xml ends here */
+STATIC_ASSERT(FLASH_APPDATA_START == 0x1F400UL, flash_crcscan_range_changed);
+STATIC_ASSERT_WITHIN(FLASH_CRC_REFERENCE_EEPROM_ADDRESS, sizeof(diag_flash_crc_t), 0, EEPROM_SIZE, flash_crc_reference_outside_eeprom);
+
+/**
+ @ingroup diag_flash_crc
+ @brief This is the state of the software Flash CRC test that survives warm resets
+ */
+typedef struct
+{
+    uint32_t cursor;
+    diag_flash_crc_t crc;
+    uint32_t check;
+} diag_flash_crc_context_t;
+
+static volatile __persistent diag_flash_crc_context_t diag_flash_crc_context;
+
+static volatile __persistent diag_flash_status_t diag_flash_crc_state;
+
+static volatile __persistent diag_flash_status_t diag_flash_crcscan_state;
+
+static void saveContext(uint32_t cursor, diag_flash_crc_t crc)
+{
+    diag_flash_crc_context.cursor = cursor;
+    diag_flash_crc_context.crc = crc;
+    diag_flash_crc_context.check = DIAG_FLASH_CRC_CHECK(cursor, crc);
+}
+
+diag_flash_status_t DIAG_FLASH_CRCScan(void)
+{
+    //The CPU is halted until the scan has completed, APPDATA is rewritten at run-time and left out
+    CRCSCAN.CTRLB = CRCSCAN_SRC_BOOT_gc;
+    CRCSCAN.CTRLA = CRCSCAN_ENABLE_bm;
+
+    while (CRCSCAN.STATUS & CRCSCAN_BUSY_bm)
+    {
+    }
+
+    if (CRCSCAN.STATUS & CRCSCAN_OK_bm)
+    {
+        diag_flash_crcscan_state = FLASH_CRC_OK;
+    }
+    else
+    {
+        diag_flash_crcscan_state = FLASH_CRC_ERROR;
+    }
+
+    return diag_flash_crcscan_state;
+}
+
+diag_flash_status_t DIAG_FLASH_CRCScan_GetStatus(void)
+{
+    return diag_flash_crcscan_state;
+}
+
+void DIAG_FLASH_CRC_Initialize(void)
+{
+    if (diag_flash_crc_context.check != DIAG_FLASH_CRC_CHECK(diag_flash_crc_context.cursor, diag_flash_crc_context.crc))
+    {
+        saveContext(FLASH_CRC_START_ADDRESS, DIAG_FLASH_CRC_INITIAL);
+        diag_flash_crc_state = FLASH_CRC_IN_PROGRESS;
+    }
+}
+
+diag_flash_status_t DIAG_FLASH_CRC_Step(void)
+{
+    register uint32_t cursor = diag_flash_crc_context.cursor;
+    register diag_flash_crc_t crc = diag_flash_crc_context.crc;
+    uint32_t end;
+    diag_flash_crc_t reference;
+
+    //Restart the pass if the persistent state has been corrupted
+    if ((diag_flash_crc_context.check != DIAG_FLASH_CRC_CHECK(cursor, crc)) ||
+            (cursor < FLASH_CRC_START_ADDRESS) ||
+            (cursor >= FLASH_CRC_END_ADDRESS))
+    {
+        cursor = FLASH_CRC_START_ADDRESS;
+        crc = DIAG_FLASH_CRC_INITIAL;
+    }
+
+    end = cursor + FLASH_CRC_SLICE_SIZE;
+    if (end > FLASH_CRC_END_ADDRESS)
+    {
+        end = FLASH_CRC_END_ADDRESS;
+    }
+
+    while (cursor < end)
+    {
+        crc = DIAG_FLASH_CRC_UPDATE(crc, pgm_read_byte_far(cursor));
+        cursor++;
+    }
+
+    if (cursor < FLASH_CRC_END_ADDRESS)
+    {
+        saveContext(cursor, crc);
+        return FLASH_CRC_IN_PROGRESS;
+    }
+
+    //End of the range - compare with the reference and start the next pass
+    FLASH_ReadEepromBlock(FLASH_CRC_REFERENCE_EEPROM_ADDRESS, (uint8_t*) &reference, sizeof (reference));
+
+    if (DIAG_FLASH_CRC_FINAL(crc) == reference)
+    {
+        diag_flash_crc_state = FLASH_CRC_OK;
+    }
+    else
+    {
+        diag_flash_crc_state = FLASH_CRC_ERROR;
+    }
+
+    saveContext(FLASH_CRC_START_ADDRESS, DIAG_FLASH_CRC_INITIAL);
+
+    return diag_flash_crc_state;
+}
+
+diag_flash_status_t DIAG_FLASH_CRC_GetStatus(void)
+{
+    return diag_flash_crc_state;
+}
+
+diag_flash_status_t DIAG_FLASH_CRC_StoreReference(void)
+{
+    register uint32_t cursor;
+    register diag_flash_crc_t crc = DIAG_FLASH_CRC_INITIAL;
+    diag_flash_crc_t reference;
+
+    for (cursor = FLASH_CRC_START_ADDRESS; cursor < FLASH_CRC_END_ADDRESS; cursor++)
+    {
+        crc = DIAG_FLASH_CRC_UPDATE(crc, pgm_read_byte_far(cursor));
+
+        if (((cursor - FLASH_CRC_START_ADDRESS) % FLASH_CRC_SLICE_SIZE) == (FLASH_CRC_SLICE_SIZE - 1))
+        {
+            DIAG_SLICE_HOOK();
+        }
+    }
+    reference = DIAG_FLASH_CRC_FINAL(crc);
+
+    if (NVM_OK != FLASH_WriteEepromBlock(FLASH_CRC_REFERENCE_EEPROM_ADDRESS, (uint8_t*) &reference, sizeof (reference)))
+    {
+        return FLASH_CRC_ERROR;
+    }
+
+    return FLASH_CRC_OK;
+}
@@ -0,0 +1,130 @@
+/**
+ *  (c) 2020 Microchip Technology Inc. and its subsidiaries.
+ *
+ *  Subject to your compliance with these terms, you may use Microchip software
+ *  and any derivatives exclusively with Microchip products. You're responsible
+ *  for complying with 3rd party license terms applicable to your use of 3rd
+ *  party software (including open source software) that may accompany Microchip
+ *  software.
+ *
+ *  SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ *  APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+ *  MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *  IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ *  INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ *  WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP
+ *  HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO
+ *  THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL
+ *  CLAIMS RELATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF FEES, IF ANY,
+ *
+ *  @file    diag_flash_crc.h
+ *  @brief   This file contains API prototypes for Flash CRC test
+ *
+ */
+
+#ifndef DIAG_FLASH_CRC_H
+#define DIAG_FLASH_CRC_H
+
+/**
+ * @brief This module contains functional safety diagnostics APIs for Flash CRC test
+ * @defgroup diag_flash_crc Flash - CRC
+ * @{
+ */
+
+#include "diag_flash_types.h"
+#include <stdint.h>
+#include <xc.h>
+
+/**
+ @ingroup diag_flash_crc
+ @brief This API checks the entire Flash using the CRCSCAN peripheral.
+
+ The CPU is halted while CRCSCAN runs, so this test is meant for startup.
+ CRCSCAN computes the checksum selected by the CRCSEL fuse over the BOOT section, which
+ holds the whole application, and expects the reference checksum in the last bytes of
+ BOOT, below FLASH_APPDATA_START. The post-build step in nbproject/configurations.xml
+ fills the unused BOOT flash of the hex file with 0xFF and has hexmate store the CRC16
+ (polynomial 0x1021, initial value 0xFFFF) of BOOT big-endian in its last two bytes,
+ matching the CRCSEL fuse in device_config.c. Only the hex file carries the checksum; an
+ image loaded by the debugger from the ELF file fails the test. APPDATA is rewritten at
+ run-time and not checked.
+
+ The test is called from DIAG_OnStartup() when DIAG_FLASH_CRCSCAN_ON_STARTUP is set
+ in diag_config.h.
+
+ Error reporting: \n
+     @ref DIAG_FLASH_CRCScan_GetStatus() should be called from main() to know
+     the status of the Flash CRCSCAN test
+
+ @return @ref FLASH_CRC_OK \n
+ @ref FLASH_CRC_ERROR \n
+ */
+diag_flash_status_t DIAG_FLASH_CRCScan(void);
+
+/**
+ @ingroup diag_flash_crc
+ @brief This API returns the status of the Flash CRCSCAN test
+
+ @return @ref FLASH_CRC_OK \n
+ @ref FLASH_CRC_ERROR \n
+*/
+diag_flash_status_t DIAG_FLASH_CRCScan_GetStatus(void);
+
+/**
+ @ingroup diag_flash_crc
+ @brief This API prepares the time-sliced software Flash CRC test.
+
+ The position of the test and the partial CRC are kept in persistent SRAM together with
+ a check word, so a pass interrupted by a warm reset continues where it stopped.
+ If the check word does not match, as after a power-on reset, the pass restarts
+ from FLASH_CRC_START_ADDRESS.
+
+ @return None
+ */
+void DIAG_FLASH_CRC_Initialize(void);
+
+/**
+ @ingroup diag_flash_crc
+ @brief This API runs one slice of the software Flash CRC test.
+
+ Each call adds FLASH_CRC_SLICE_SIZE bytes of the range FLASH_CRC_START_ADDRESS to
+ FLASH_CRC_END_ADDRESS to the CRC. The call that reaches the end of the range compares
+ the CRC with the reference stored in EEPROM at FLASH_CRC_REFERENCE_EEPROM_ADDRESS
+ and starts the next pass.
+
+ The CRC width is selected with DIAG_FLASH_CRC32 and the implementation variant
+ (bitwise, nibble or table) with CRC_IMPLEMENTATION, see crc.h for the cost per byte.
+ A slice costs about FLASH_CRC_SLICE_SIZE times that cost plus the Flash read.
+
+ @return @ref FLASH_CRC_IN_PROGRESS while the pass is not complete \n
+ @ref FLASH_CRC_OK \n
+ @ref FLASH_CRC_ERROR \n
+ */
+diag_flash_status_t DIAG_FLASH_CRC_Step(void);
+
+/**
+ @ingroup diag_flash_crc
+ @brief This API returns the result of the last complete software Flash CRC pass
+
+ @return @ref FLASH_CRC_IN_PROGRESS if no pass has completed yet \n
+ @ref FLASH_CRC_OK \n
+ @ref FLASH_CRC_ERROR \n
+*/
+diag_flash_status_t DIAG_FLASH_CRC_GetStatus(void);
+
+/**
+ @ingroup diag_flash_crc
+ @brief This API computes the CRC of the whole range and stores it as reference in EEPROM.
+
+ Intended to be called once, at production time, on a known good image.
+
+ @return @ref FLASH_CRC_OK \n
+ @ref FLASH_CRC_ERROR if the EEPROM write failed \n
+ */
+diag_flash_status_t DIAG_FLASH_CRC_StoreReference(void);
+
+/**
+ * @}
+ */
+#endif //DIAG_FLASH_CRC_H
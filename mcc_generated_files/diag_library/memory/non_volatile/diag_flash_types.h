@@ -0,0 +1,46 @@
+/**
+ *  (c) 2020 Microchip Technology Inc. and its subsidiaries.
+ *
+ *  Subject to your compliance with these terms, you may use Microchip software
+ *  and any derivatives exclusively with Microchip products. You're responsible
+ *  for complying with 3rd party license terms applicable to your use of 3rd
+ *  party software (including open source software) that may accompany Microchip
+ *  software.
+ *
+ *  SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ *  APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+ *  MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *  IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ *  INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ *  WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP
+ *  HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO
+ *  THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL
+ *  CLAIMS RELATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF FEES, IF ANY,
+ *
+ *  @file    diag_flash_types.h
+ *  @brief   This file contains common type definitions for Flash diagnostics module
+ *
+ */
+
+#ifndef DIAG_FLASH_TYPES_H
+#define DIAG_FLASH_TYPES_H
+
+/**
+ @enum diag_flash_status_t
+ @brief This enumeration contains return codes for Flash diagnostics tests
+ @var diag_flash_status_t:: FLASH_CRC_OK
+ 0 - indicates that Flash test is successful \n
+ @var diag_flash_status_t:: FLASH_CRC_ERROR
+ 1 - indicates that Flash test is unsuccessful \n
+ @var diag_flash_status_t:: FLASH_CRC_IN_PROGRESS
+ 2 - indicates that no complete pass of the Flash test has finished yet \n
+ */
+typedef enum
+{
+    FLASH_CRC_OK = 0,
+    FLASH_CRC_ERROR = 1,
+    FLASH_CRC_IN_PROGRESS = 2
+} diag_flash_status_t;
+
+#endif //DIAG_FLASH_TYPES_H
@@ -35,6 +35,8 @@
 #include <xc.h>
 #include "diag_sram_checkerboard.h"
 #include "../../../diag_common/config/diag_config.h"
+#include "../../../include/utils/utils_assert.h"
+#include "../../../include/utils/atomic.h"
 
 /**
  @ingroup diag_sram_checkerboard
@@ -54,6 +56,8 @@
 
 volatile uint8_t checkerbrd_buffer[SRAM_SEC_SIZE] __at(0x800000 + CHECKERBOARD_BUFFER_OFFSET);
 
+STATIC_ASSERT_WITHIN(CHECKERBOARD_BUFFER_OFFSET, SRAM_SEC_SIZE, INTERNAL_SRAM_START, INTERNAL_SRAM_SIZE, checkerboard_buffer_outside_sram);
+
 static diag_sram_status_t checkboardTest(register uint8_t* address, register uint8_t size)
 {
     register uint8_t i;
@@ -135,9 +139,6 @@ diag_sram_status_t DIAG_SRAM_CheckerBoard(register volatile uint8_t* startAddres
     register uint16_t sections = length / SRAM_SEC_SIZE;
     register uint8_t remainder = length % SRAM_SEC_SIZE;
 
-    //Backup GIE status
-    register bool gieStatus = SREG | CPU_I_bm;
-
     if ((startAddress < (uint8_t*) INTERNAL_SRAM_START) ||
             (startAddress > (uint8_t*) (INTERNAL_SRAM_START + INTERNAL_SRAM_SIZE)) ||
             (length == 0) ||
@@ -145,35 +146,35 @@ diag_sram_status_t DIAG_SRAM_CheckerBoard(register volatile uint8_t* startAddres
             )
         return SRAM_ERROR;
 
-    //Disable global interrupts during this test
-    SREG &= (~CPU_I_bm);
-
     //Save content of the current section before running SRAM CheckerBoard test
+    //Global interrupts are disabled while a section is under test, SREG is restored on every return
+    //Each section is restored before the next, so interrupts and the slice hook may run in between
     for (nSec = 0; nSec < sections; nSec++)
     {
         p_sram = (uint8_t*) (startAddress + (SRAM_SEC_SIZE * nSec));
 
-        if (SRAM_ERROR == checkboardTest(p_sram, SRAM_SEC_SIZE))
+        CRITICAL_SECTION()
         {
-            //Restore global interrupt enable bit status
-            SREG |= (gieStatus << CPU_I_bp);
-            return SRAM_ERROR;
+            if (SRAM_ERROR == checkboardTest(p_sram, SRAM_SEC_SIZE))
+            {
+                return SRAM_ERROR;
+            }
         }
+        DIAG_SLICE_HOOK();
     }
 
     if (remainder)
     {
         p_sram = (uint8_t*) (startAddress + (SRAM_SEC_SIZE * (sections - 1)));
 
-        if (SRAM_ERROR == checkboardTest(p_sram, remainder))
+        CRITICAL_SECTION()
         {
-            //Restore global interrupt enable bit status
-            SREG |= (gieStatus << CPU_I_bp);
-            return SRAM_ERROR;
+            if (SRAM_ERROR == checkboardTest(p_sram, remainder))
+            {
+                return SRAM_ERROR;
+            }
         }
     }
 
-    //Restore global interrupt enable bit status
-    SREG |= (gieStatus << CPU_I_bp);
     return SRAM_OK;
 }
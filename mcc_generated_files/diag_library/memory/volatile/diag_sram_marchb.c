@@ -34,6 +34,8 @@
 #include <stdbool.h>
 #include "diag_sram_marchb.h"
 #include "../../../diag_common/config/diag_config.h"
+#include "../../../include/utils/utils_assert.h"
+#include "../../../include/utils/atomic.h"
 
 /**
  @ingroup diag_sram_marchb
@@ -53,6 +55,10 @@
 
 volatile uint8_t march_buffer[SRAM_SEC_SIZE] __at(0x800000 + MARCH_BUFFER_OFFSET);
 
+STATIC_ASSERT_WITHIN(MARCH_BUFFER_OFFSET, SRAM_SEC_SIZE, INTERNAL_SRAM_START, INTERNAL_SRAM_SIZE, march_buffer_outside_sram);
+STATIC_ASSERT_NO_OVERLAP(MARCH_BUFFER_OFFSET, SRAM_SEC_SIZE, CHECKERBOARD_BUFFER_OFFSET, SRAM_SEC_SIZE, march_buffer_overlaps_checkerboard_buffer);
+STATIC_ASSERT((INTERNAL_SRAM_SIZE % SRAM_SEC_SIZE) == 0, sram_not_whole_sections);
+
 static volatile __persistent diag_sram_status_t diag_sram_marchb_state;
 
 void DIAG_SRAM_MarchB(void)
@@ -66,153 +72,160 @@ void DIAG_SRAM_MarchB(void)
     {
         p_sram = (uint8_t*) (INTERNAL_SRAM_START + (SRAM_SEC_SIZE * nSec));
 
-        //Save content of the current section before running March-B test, unless we are testing the march_buffer itself
-        if (p_sram != (uint8_t*) march_buffer)
+        //Global interrupts are disabled while a section is under test, so ISR stack frames cannot land in it
+        //and the restore cannot roll back ISR updates to it, SREG is restored on every return
+        CRITICAL_SECTION()
         {
+            //Save content of the current section before running March-B test, unless we are testing the march_buffer itself
+            if (p_sram != (uint8_t*) march_buffer)
+            {
+                for (i = 0; i < SRAM_SEC_SIZE; i++)
+                {
+                    march_buffer[i] = *(p_sram + i);
+                }
+
+                //Check that the saved content is not corrupted
+                for (i = 0; i < SRAM_SEC_SIZE; i++)
+                {
+                    if (march_buffer[i] != *(p_sram + i))
+                    {
+                        diag_sram_marchb_state = SRAM_ERROR;
+                        return;
+                    }
+                }
+            }
+
+            //Step-1: Any order - taken as ascending in this case
+            //Write 0 to all bit locations
             for (i = 0; i < SRAM_SEC_SIZE; i++)
             {
-                march_buffer[i] = *(p_sram + i);
+                *(p_sram + i) = 0x00;
             }
 
-            //Check that the saved content is not corrupted
+            //Step-2: Ascending -  Read 0, Write 1; Read 1, Write 0; Read 0, Write 1
+            //Read a bit and verify that it is 0. If it is 1, a fault has occurred
+            //If read as 0, write 1 to its location
+            //Read the bit and verify it is 1. If it is 0, a fault has occurred
+            //If read as 1, write 0 to its location
+            //Read the bit and verify that it is 0. If it is 1, fault has occurred
+            //If read as 0, write 1 to its location
+            //Repeat the same process for the next bit
             for (i = 0; i < SRAM_SEC_SIZE; i++)
             {
-                if (march_buffer[i] != *(p_sram + i))
+                //Read 0, Write 1
+                if (*(p_sram + i) != 0x0)
                 {
                     diag_sram_marchb_state = SRAM_ERROR;
                     return;
                 }
-            }
-        }
-
-        //Step-1: Any order - taken as ascending in this case
-        //Write 0 to all bit locations
-        for (i = 0; i < SRAM_SEC_SIZE; i++)
-        {
-            *(p_sram + i) = 0x00;
-        }
-
-        //Step-2: Ascending -  Read 0, Write 1; Read 1, Write 0; Read 0, Write 1
-        //Read a bit and verify that it is 0. If it is 1, a fault has occurred
-        //If read as 0, write 1 to its location
-        //Read the bit and verify it is 1. If it is 0, a fault has occurred
-        //If read as 1, write 0 to its location
-        //Read the bit and verify that it is 0. If it is 1, fault has occurred
-        //If read as 0, write 1 to its location
-        //Repeat the same process for the next bit
-        for (i = 0; i < SRAM_SEC_SIZE; i++)
-        {
-            //Read 0, Write 1
-            if (*(p_sram + i) != 0x0)
-            {
-                diag_sram_marchb_state = SRAM_ERROR;
-                return;
-            }
-            else
-            {
-                *(p_sram + i) = 0xFF;
-            }
+                else
+                {
+                    *(p_sram + i) = 0xFF;
+                }
 
-            //Read 1, Write 0
-            if (*(p_sram + i) != 0xFF)
-            {
-                diag_sram_marchb_state = SRAM_ERROR;
-                return;
-            }
-            else
-            {
-                *(p_sram + i) = 0x0;
-            }
+                //Read 1, Write 0
+                if (*(p_sram + i) != 0xFF)
+                {
+                    diag_sram_marchb_state = SRAM_ERROR;
+                    return;
+                }
+                else
+                {
+                    *(p_sram + i) = 0x0;
+                }
 
-            //Read 0, Write 1
-            if (*(p_sram + i) != 0x0)
-            {
-                diag_sram_marchb_state = SRAM_ERROR;
-                return;
-            }
-            else
-            {
-                *(p_sram + i) = 0xFF;
+                //Read 0, Write 1
+                if (*(p_sram + i) != 0x0)
+                {
+                    diag_sram_marchb_state = SRAM_ERROR;
+                    return;
+                }
+                else
+                {
+                    *(p_sram + i) = 0xFF;
+                }
             }
-        }
 
-        //Step-3: Ascending - Read 1, Write 0; Write 1
-        //Read a bit and verify that it is 1. If it is 0, a fault has occurred.
-        //If read as 1, write 0 to its location
-        //Write 1 to its location
-        //Repeat the same process for the next bit
-        for (i = 0; i < SRAM_SEC_SIZE; i++)
-        {
-            if (*(p_sram + i) != 0xFF)
-            {
-                diag_sram_marchb_state = SRAM_ERROR;
-                return;
-            }
-            else
+            //Step-3: Ascending - Read 1, Write 0; Write 1
+            //Read a bit and verify that it is 1. If it is 0, a fault has occurred.
+            //If read as 1, write 0 to its location
+            //Write 1 to its location
+            //Repeat the same process for the next bit
+            for (i = 0; i < SRAM_SEC_SIZE; i++)
             {
-                *(p_sram + i) = 0x0;
-                *(p_sram + i) = 0xFF;
+                if (*(p_sram + i) != 0xFF)
+                {
+                    diag_sram_marchb_state = SRAM_ERROR;
+                    return;
+                }
+                else
+                {
+                    *(p_sram + i) = 0x0;
+                    *(p_sram + i) = 0xFF;
+                }
             }
-        }
 
-        //Step-4: Descending - Read 1, Write 0, Write 1, Write 0
-        //Read a bit and verify that it is 1. If its is 0, fault has occurred
-        //If read as 1, write 0 to its location
-        //Write 1 to its location
-        //Write 0 to its location
-        //Repeat the same process for the next bit
-        for (i = SRAM_SEC_SIZE; i > 0; i--)
-        {
-            if (*(p_sram + (i - 1)) != 0xFF)
-            {
-                diag_sram_marchb_state = SRAM_ERROR;
-                return;
-            }
-            else
+            //Step-4: Descending - Read 1, Write 0, Write 1, Write 0
+            //Read a bit and verify that it is 1. If its is 0, fault has occurred
+            //If read as 1, write 0 to its location
+            //Write 1 to its location
+            //Write 0 to its location
+            //Repeat the same process for the next bit
+            for (i = SRAM_SEC_SIZE; i > 0; i--)
             {
-                *(p_sram + (i - 1)) = 0;
-                *(p_sram + (i - 1)) = 1;
-                *(p_sram + (i - 1)) = 0;
+                if (*(p_sram + (i - 1)) != 0xFF)
+                {
+                    diag_sram_marchb_state = SRAM_ERROR;
+                    return;
+                }
+                else
+                {
+                    *(p_sram + (i - 1)) = 0;
+                    *(p_sram + (i - 1)) = 1;
+                    *(p_sram + (i - 1)) = 0;
+                }
             }
-        }
 
-        //Step-5: Descending - Read 0, Write 1, Write 0
-        //Read a bit and verify that it is 0. If its is 1, fault has occurred
-        //If read as 0, write 1 to its location
-        //Write 0 to its location
-        //Repeat the same process for the next bit
-        for (i = SRAM_SEC_SIZE; i > 0; i--)
-        {
-            if (*(p_sram + (i - 1)) != 0x0)
-            {
-                diag_sram_marchb_state = SRAM_ERROR;
-                return;
-            }
-            else
+            //Step-5: Descending - Read 0, Write 1, Write 0
+            //Read a bit and verify that it is 0. If its is 1, fault has occurred
+            //If read as 0, write 1 to its location
+            //Write 0 to its location
+            //Repeat the same process for the next bit
+            for (i = SRAM_SEC_SIZE; i > 0; i--)
             {
-                *(p_sram + (i - 1)) = 1;
-                *(p_sram + (i - 1)) = 0;
+                if (*(p_sram + (i - 1)) != 0x0)
+                {
+                    diag_sram_marchb_state = SRAM_ERROR;
+                    return;
+                }
+                else
+                {
+                    *(p_sram + (i - 1)) = 1;
+                    *(p_sram + (i - 1)) = 0;
+                }
             }
-        }
 
-        //Restore the contents of current SRAM section from march_buffer, unless we are testing the march_buffer itself
-        if (p_sram != (uint8_t*) march_buffer)
-        {
-            for (i = 0; i < SRAM_SEC_SIZE; i++)
+            //Restore the contents of current SRAM section from march_buffer, unless we are testing the march_buffer itself
+            if (p_sram != (uint8_t*) march_buffer)
             {
-                *(p_sram + i) = march_buffer[i];
-            }
+                for (i = 0; i < SRAM_SEC_SIZE; i++)
+                {
+                    *(p_sram + i) = march_buffer[i];
+                }
 
-            //Check that the restored content is not corrupted
-            for (i = 0; i < SRAM_SEC_SIZE; i++)
-            {
-                if (*(p_sram + i) != march_buffer[i])
+                //Check that the restored content is not corrupted
+                for (i = 0; i < SRAM_SEC_SIZE; i++)
                 {
-                    diag_sram_marchb_state = SRAM_ERROR;
-                    return;
+                    if (*(p_sram + i) != march_buffer[i])
+                    {
+                        diag_sram_marchb_state = SRAM_ERROR;
+                        return;
+                    }
                 }
             }
         }
+
+        DIAG_SLICE_HOOK();
     }
 
     diag_sram_marchb_state = SRAM_OK;
@@ -0,0 +1,1170 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#include "../include/mcc.h"
+#include "../include/timebase.h"
+#include "../include/utils/ring_buffer.h"
+#include "../include/format.h"
+#include "../include/crc.h"
+#include "../diag_common/config/diag_config.h"
+#include "../diag_library/memory/non_volatile/diag_flash_crc.h"
+#include "../diag_library/memory/volatile/diag_sram_checkerboard.h"
+#include "../diag_library/memory/volatile/diag_sram_marchb.h"
+#include "../include/diag_cpu_registers.h"
+#include "../include/pin_descriptor.h"
+#include "../include/port_interrupt.h"
+#include "../include/ccp.h"
+#include "benchmark_example.h"
+#include <avr/sleep.h>
+#include <stdio.h>
+#include <string.h>
+
+#if BENCHMARK_ENABLE
+
+/*
+    CPUINT benchmark
+
+    Runs on TCA0, which free-runs at CLK_PER/1 for the timebase, so one
+    count is one CPU cycle.
+
+    Entry latency: CMP1 fires at a known count, its ISR reads TCA0.CNT
+    first thing. The difference is the cycles from the compare match to
+    the first instruction of the handler body, prologue included.
+
+    Preemption delay: CMP2 fires shortly before CMP1 and its ISR busy-waits
+    for BENCHMARK_BLOCK_CYCLES. The CMP1 latency shows how long the
+    "commutation" interrupt waits behind another handler.
+
+    Each configuration is measured BENCHMARK_RUNS times and the worst case
+    is reported. The compact vector table is not benchmarked: it needs a
+    differently linked vector table, and it saves flash, not cycles.
+ */
+
+#define BENCHMARK_RUNS 16
+#define BENCHMARK_LEAD_CYCLES 400
+#define BENCHMARK_BLOCK_CYCLES 300
+#define BENCHMARK_OFFSET_CYCLES 20
+
+static volatile uint16_t benchmark_cmp1_latency;
+static volatile bool benchmark_cmp1_done;
+
+ISR(TCA0_CMP1_vect)
+{
+    TIMEBASE_TEMP_SAVE();
+    uint16_t now = TCA0.SINGLE.CNT;
+
+    benchmark_cmp1_latency = now - TCA0.SINGLE.CMP1;
+    TCA0.SINGLE.INTCTRL &= ~TCA_SINGLE_CMP1_bm;
+    TCA0.SINGLE.INTFLAGS = TCA_SINGLE_CMP1_bm;
+    benchmark_cmp1_done = true;
+    TIMEBASE_TEMP_RESTORE();
+}
+
+ISR(TCA0_CMP2_vect)
+{
+    TIMEBASE_TEMP_SAVE();
+    uint16_t start = TCA0.SINGLE.CMP2;
+
+    while ((uint16_t)(TCA0.SINGLE.CNT - start) < BENCHMARK_BLOCK_CYCLES)
+    {
+    }
+    TCA0.SINGLE.INTCTRL &= ~TCA_SINGLE_CMP2_bm;
+    TCA0.SINGLE.INTFLAGS = TCA_SINGLE_CMP2_bm;
+    TIMEBASE_TEMP_RESTORE();
+}
+
+static uint16_t CPUINT_Benchmark_Run(bool blocked)
+{
+    uint16_t worst = 0;
+
+    for (uint8_t run = 0; run < BENCHMARK_RUNS; run++)
+    {
+        uint16_t at;
+
+        benchmark_cmp1_done = false;
+
+        ENTER_CRITICAL(R);
+        at = TCA0.SINGLE.CNT + BENCHMARK_LEAD_CYCLES;
+        TCA0.SINGLE.CMP2 = at;
+        TCA0.SINGLE.CMP1 = at + (blocked ? BENCHMARK_OFFSET_CYCLES : 0);
+        TCA0.SINGLE.INTFLAGS = TCA_SINGLE_CMP1_bm | TCA_SINGLE_CMP2_bm;
+        TCA0.SINGLE.INTCTRL |= TCA_SINGLE_CMP1_bm | (blocked ? TCA_SINGLE_CMP2_bm : 0);
+        EXIT_CRITICAL(R);
+
+        while (!benchmark_cmp1_done)
+        {
+        }
+
+        if (benchmark_cmp1_latency > worst)
+        {
+            worst = benchmark_cmp1_latency;
+        }
+    }
+
+    return worst;
+}
+
+/* name is a PSTR() string */
+static void CPUINT_Benchmark_Report(const char *name)
+{
+    uint16_t entry = CPUINT_Benchmark_Run(false);
+    uint16_t blocked = CPUINT_Benchmark_Run(true);
+
+    FMT_PUTS("\r\n");
+    FMT_PutString_P(name);
+    FMT_PUTS(": entry ");
+    FMT_PutUnsigned(entry);
+    FMT_PUTS(" cycles, behind ");
+    FMT_PutUnsigned(BENCHMARK_BLOCK_CYCLES);
+    FMT_PUTS("-cycle ISR ");
+    FMT_PutUnsigned(blocked);
+    FMT_PUTS(" cycles\r\n");
+}
+
+void CPUINT_Benchmark(void)
+{
+    CPUINT_SetLevel1Vector(0);
+    CPUINT_SetRoundRobin(false);
+    CPUINT_SetLevel0Priority(0);
+    CPUINT_Benchmark_Report(PSTR("Level 0, static priority"));
+
+    CPUINT_SetRoundRobin(true);
+    CPUINT_Benchmark_Report(PSTR("Level 0, round robin"));
+    CPUINT_SetRoundRobin(false);
+
+    //CMP2 lowest, so CMP1 wins when both are pending
+    CPUINT_SetLevel0Priority(TCA0_CMP2_vect_num);
+    CPUINT_Benchmark_Report(PSTR("Level 0, CMP1 prioritized"));
+    CPUINT_SetLevel0Priority(0);
+
+    CPUINT_SET_LEVEL1(TCA0_CMP1_vect);
+    CPUINT_Benchmark_Report(PSTR("Level 1"));
+    CPUINT_SetLevel1Vector(0);
+}
+
+/*
+    Ring buffer benchmark
+
+    Pushes and pops BENCHMARK_RB_ELEMENTS bytes one at a time and in bulk,
+    timed with TCA0.CNT around each loop. Interrupts are off only so an
+    ISR does not land inside the measurement, the buffer itself does not
+    need it. Loop overhead is included in the per-element figures.
+ */
+
+#define BENCHMARK_RB_ELEMENTS 64
+
+RING_BUFFER_DECLARE(benchmark_rb, uint8_t, BENCHMARK_RB_ELEMENTS)
+
+static benchmark_rb_t benchmark_rb;
+static uint8_t benchmark_rb_data[BENCHMARK_RB_ELEMENTS];
+
+void RingBuffer_Benchmark(void)
+{
+    uint16_t push, pop, push_bulk, pop_bulk;
+    uint16_t start;
+    uint8_t value;
+
+    ENTER_CRITICAL(R);
+
+    start = TCA0.SINGLE.CNT;
+    for (uint8_t i = 0; i < BENCHMARK_RB_ELEMENTS; i++)
+    {
+        benchmark_rb_Push(&benchmark_rb, i);
+    }
+    push = TCA0.SINGLE.CNT - start;
+
+    start = TCA0.SINGLE.CNT;
+    for (uint8_t i = 0; i < BENCHMARK_RB_ELEMENTS; i++)
+    {
+        benchmark_rb_Pop(&benchmark_rb, &value);
+        benchmark_rb_data[i] = value;
+    }
+    pop = TCA0.SINGLE.CNT - start;
+
+    start = TCA0.SINGLE.CNT;
+    benchmark_rb_PushBulk(&benchmark_rb, benchmark_rb_data, BENCHMARK_RB_ELEMENTS);
+    push_bulk = TCA0.SINGLE.CNT - start;
+
+    start = TCA0.SINGLE.CNT;
+    benchmark_rb_PopBulk(&benchmark_rb, benchmark_rb_data, BENCHMARK_RB_ELEMENTS);
+    pop_bulk = TCA0.SINGLE.CNT - start;
+
+    EXIT_CRITICAL(R);
+
+    FMT_PUTS("\r\nRing buffer, cycles per element x10: push ");
+    FMT_PutUnsigned(push * 10U / BENCHMARK_RB_ELEMENTS);
+    FMT_PUTS(", pop ");
+    FMT_PutUnsigned(pop * 10U / BENCHMARK_RB_ELEMENTS);
+    FMT_PUTS(", bulk push ");
+    FMT_PutUnsigned(push_bulk * 10U / BENCHMARK_RB_ELEMENTS);
+    FMT_PUTS(", bulk pop ");
+    FMT_PutUnsigned(pop_bulk * 10U / BENCHMARK_RB_ELEMENTS);
+    FMT_PUTS("\r\n");
+}
+
+/*
+    Formatter benchmark
+
+    Queues the same status line with printf() and with the FMT_ functions
+    and reports the cycles each took. Interrupts are off while measuring,
+    so the line has to fit in the transmit buffer; the benchmark waits for
+    the transmitter to drain before each run.
+ */
+
+static uint16_t Format_Benchmark_Printf(int32_t value)
+{
+    uint16_t start;
+    uint16_t cycles;
+
+    while (!USART1_IsTxDone())
+    {
+    }
+
+    ENTER_CRITICAL(R);
+    start = TCA0.SINGLE.CNT;
+    printf("\r\nPassed : Clock test, %ld ppm\r\n", (long) value);
+    cycles = TCA0.SINGLE.CNT - start;
+    EXIT_CRITICAL(R);
+
+    return cycles;
+}
+
+static uint16_t Format_Benchmark_Fmt(int32_t value)
+{
+    uint16_t start;
+    uint16_t cycles;
+
+    while (!USART1_IsTxDone())
+    {
+    }
+
+    ENTER_CRITICAL(R);
+    start = TCA0.SINGLE.CNT;
+    FMT_PUTS("\r\nPassed : Clock test, ");
+    FMT_PutSigned(value);
+    FMT_PUTS(" ppm\r\n");
+    cycles = TCA0.SINGLE.CNT - start;
+    EXIT_CRITICAL(R);
+
+    return cycles;
+}
+
+void Format_Benchmark(void)
+{
+    uint16_t with_printf = Format_Benchmark_Printf(-123456L);
+    uint16_t with_fmt = Format_Benchmark_Fmt(-123456L);
+
+    FMT_PUTS("\r\nStatus line cycles: printf ");
+    FMT_PutUnsigned(with_printf);
+    FMT_PUTS(", FMT ");
+    FMT_PutUnsigned(with_fmt);
+    FMT_PUTS("\r\n");
+}
+
+/*
+    Critical section benchmark
+
+    Times BENCHMARK_CS_LOOPS volatile increments wrapped in each kind of
+    critical section and reports the cycles each section adds per
+    increment, x10. The stack-based sequence ENTER_CRITICAL() used before
+    is kept here as the reference. Interrupts stay on, so the minimum of
+    BENCHMARK_RUNS runs is taken to leave out runs an ISR landed in.
+ */
+
+#define BENCHMARK_CS_LOOPS 32
+
+static volatile uint8_t benchmark_cs_counter;
+
+typedef uint16_t (*benchmark_cs_t)(void);
+
+static uint16_t CriticalSection_Benchmark_None(void)
+{
+    uint16_t start = TCA0.SINGLE.CNT;
+
+    for (uint8_t i = 0; i < BENCHMARK_CS_LOOPS; i++)
+    {
+        benchmark_cs_counter++;
+    }
+    return TCA0.SINGLE.CNT - start;
+}
+
+static uint16_t CriticalSection_Benchmark_Stack(void)
+{
+    uint16_t start = TCA0.SINGLE.CNT;
+
+    for (uint8_t i = 0; i < BENCHMARK_CS_LOOPS; i++)
+    {
+        __asm__ __volatile__("in __tmp_reg__, __SREG__\n\tcli\n\tpush __tmp_reg__" ::: "memory");
+        benchmark_cs_counter++;
+        __asm__ __volatile__("pop __tmp_reg__\n\tout __SREG__, __tmp_reg__" ::: "memory");
+    }
+    return TCA0.SINGLE.CNT - start;
+}
+
+static uint16_t CriticalSection_Benchmark_Register(void)
+{
+    uint16_t start = TCA0.SINGLE.CNT;
+
+    for (uint8_t i = 0; i < BENCHMARK_CS_LOOPS; i++)
+    {
+        ENTER_CRITICAL(R);
+        benchmark_cs_counter++;
+        EXIT_CRITICAL(R);
+    }
+    return TCA0.SINGLE.CNT - start;
+}
+
+static uint16_t CriticalSection_Benchmark_Scoped(void)
+{
+    uint16_t start = TCA0.SINGLE.CNT;
+
+    for (uint8_t i = 0; i < BENCHMARK_CS_LOOPS; i++)
+    {
+        CRITICAL_SECTION()
+        {
+            benchmark_cs_counter++;
+        }
+    }
+    return TCA0.SINGLE.CNT - start;
+}
+
+static uint16_t CriticalSection_Benchmark_Mask(void)
+{
+    uint16_t start = TCA0.SINGLE.CNT;
+
+    for (uint8_t i = 0; i < BENCHMARK_CS_LOOPS; i++)
+    {
+        ENTER_CRITICAL_MASK(M, TCA0.SINGLE.INTCTRL, TCA_SINGLE_CMP0_bm);
+        benchmark_cs_counter++;
+        EXIT_CRITICAL_MASK(M, TCA0.SINGLE.INTCTRL);
+    }
+    return TCA0.SINGLE.CNT - start;
+}
+
+static uint16_t CriticalSection_Benchmark_Min(benchmark_cs_t run)
+{
+    uint16_t best = UINT16_MAX;
+
+    for (uint8_t i = 0; i < BENCHMARK_RUNS; i++)
+    {
+        uint16_t cycles = run();
+
+        if (cycles < best)
+        {
+            best = cycles;
+        }
+    }
+    return best;
+}
+
+static void CriticalSection_Benchmark_Print(const char *name, uint16_t cycles, uint16_t baseline)
+{
+    FMT_PutString_P(name);
+    FMT_PutUnsigned((uint16_t)(cycles - baseline) * 10U / BENCHMARK_CS_LOOPS);
+}
+
+void CriticalSection_Benchmark(void)
+{
+    uint16_t baseline = CriticalSection_Benchmark_Min(CriticalSection_Benchmark_None);
+
+    FMT_PUTS("\r\nCritical section cycles x10:");
+    CriticalSection_Benchmark_Print(PSTR(" stack "),
+                                    CriticalSection_Benchmark_Min(CriticalSection_Benchmark_Stack), baseline);
+    CriticalSection_Benchmark_Print(PSTR(", register "),
+                                    CriticalSection_Benchmark_Min(CriticalSection_Benchmark_Register), baseline);
+    CriticalSection_Benchmark_Print(PSTR(", scoped "),
+                                    CriticalSection_Benchmark_Min(CriticalSection_Benchmark_Scoped), baseline);
+    CriticalSection_Benchmark_Print(PSTR(", mask "),
+                                    CriticalSection_Benchmark_Min(CriticalSection_Benchmark_Mask), baseline);
+    FMT_PUTS("\r\n");
+}
+
+/*
+    Watchdog slice benchmark
+
+    Times the slices the diagnostic tests feed the watchdog between: a
+    whole pass of DIAG_FLASH_CRC_Step() keeping the longest step, which
+    includes the reference check at the end of the pass, and one SRAM
+    section of DIAG_SRAM_CheckerBoard(). Interrupts stay on, so handlers
+    landing in a slice are counted as they would be in the field. Both
+    must stay below the limit WATCHDOG_GetSliceLimitUs() derives from the
+    shortest timeout the oscillator tolerance allows.
+
+    A full March-B run follows, and the longest time between two kicks
+    over all three tests is checked against that shortest timeout. The
+    verdict only means something in window mode, the default, where kick
+    gaps are tracked.
+ */
+
+void Watchdog_Benchmark(void)
+{
+    timebase_t flash_max = 0;
+    timebase_t start;
+    timebase_t elapsed;
+    diag_flash_status_t status;
+    uint32_t limit;
+    uint32_t gap;
+
+    WATCHDOG_TakeMaxKickGapUs();
+
+    DIAG_FLASH_CRC_Initialize();
+    do
+    {
+        start = TIMEBASE_Now();
+        status = DIAG_FLASH_CRC_Step();
+        elapsed = TIMEBASE_ELAPSED(start, TIMEBASE_Now());
+        if (elapsed > flash_max)
+        {
+            flash_max = elapsed;
+        }
+    } while (status == FLASH_CRC_IN_PROGRESS);
+
+    start = TIMEBASE_Now();
+    DIAG_SRAM_CheckerBoard((uint8_t*) INTERNAL_SRAM_START, SRAM_SEC_SIZE);
+    elapsed = TIMEBASE_ELAPSED(start, TIMEBASE_Now());
+
+    DIAG_SRAM_MarchB();
+    gap = WATCHDOG_TakeMaxKickGapUs();
+    limit = WATCHDOG_GetSliceLimitUs();
+
+    if ((TIMEBASE_TicksToUs(flash_max) < limit) && (TIMEBASE_TicksToUs(elapsed) < limit)
+        && (gap < WATCHDOG_GetTimeoutUs()))
+    {
+        FMT_PUTS("\r\nPassed : Watchdog slices, us: limit ");
+    }
+    else
+    {
+        FMT_PUTS("\r\nFailed : Watchdog slices, us: limit ");
+    }
+    FMT_PutUnsigned(limit);
+    FMT_PUTS(", flash CRC ");
+    FMT_PutUnsigned(TIMEBASE_TicksToUs(flash_max));
+    FMT_PUTS(", SRAM section ");
+    FMT_PutUnsigned(TIMEBASE_TicksToUs(elapsed));
+    FMT_PUTS(", kick gap ");
+    FMT_PutUnsigned(gap);
+    FMT_PUTS(" of ");
+    FMT_PutUnsigned(WATCHDOG_GetTimeoutUs());
+    FMT_PUTS("\r\n");
+}
+
+/*
+    CPU register test benchmark
+
+    Times each DIAG_CPU_Registers_Step() of one pass, call and return
+    included, to check the figures budgeted in diag_cpu_registers.h. The
+    timer read adds a few cycles. Interrupts are off while measuring.
+ */
+
+void CpuRegisters_Benchmark(void)
+{
+    uint16_t cycles[DIAG_CPU_REGISTERS_SLICES];
+    uint16_t start;
+
+    /* Finish a pass the application may have left halfway */
+    while (DIAG_CPU_Registers_Step() == CPU_REGISTERS_IN_PROGRESS)
+    {
+    }
+
+    ENTER_CRITICAL(R);
+    for (uint8_t i = 0; i < DIAG_CPU_REGISTERS_SLICES; i++)
+    {
+        start = TCA0.SINGLE.CNT;
+        DIAG_CPU_Registers_Step();
+        cycles[i] = TCA0.SINGLE.CNT - start;
+    }
+    EXIT_CRITICAL(R);
+
+    FMT_PUTS("\r\nCPU register test step cycles:");
+    for (uint8_t i = 0; i < DIAG_CPU_REGISTERS_SLICES; i++)
+    {
+        FMT_PutChar(' ');
+        FMT_PutUnsigned(cycles[i]);
+    }
+    FMT_PUTS("\r\n");
+}
+
+/*
+    CRC benchmark
+
+    Runs every CRC variant over the same BENCHMARK_CRC_SIZE bytes in RAM
+    and reports the cycles per byte, call and loop overhead included.
+    All variants are compiled in because BENCHMARK_ENABLE sets
+    CRC_ALL_VARIANTS, see crc.h. Interrupts are off while measuring.
+ */
+
+#define BENCHMARK_CRC_SIZE 256
+
+static uint8_t benchmark_crc_data[BENCHMARK_CRC_SIZE];
+
+/* name is a PSTR() string */
+static void CRC_Benchmark_Print(const char *name, uint16_t crc16_cycles, uint16_t crc32_cycles)
+{
+    FMT_PUTS("\r\n");
+    FMT_PutString_P(name);
+    FMT_PUTS(": CRC16 ");
+    FMT_PutFixed((int32_t) crc16_cycles * 10 / BENCHMARK_CRC_SIZE, 1);
+    FMT_PUTS(", CRC32 ");
+    FMT_PutFixed((int32_t) crc32_cycles * 10 / BENCHMARK_CRC_SIZE, 1);
+}
+
+void CRC_Benchmark(void)
+{
+    uint16_t cycles[6];
+    uint16_t start;
+    volatile uint16_t crc16;
+    volatile uint32_t crc32;
+
+    for (uint16_t i = 0; i < BENCHMARK_CRC_SIZE; i++)
+    {
+        benchmark_crc_data[i] = (uint8_t) i;
+    }
+
+    ENTER_CRITICAL(R);
+
+    start = TCA0.SINGLE.CNT;
+    crc16 = CRC16_UpdateBitwise(CRC16_INITIAL, benchmark_crc_data, BENCHMARK_CRC_SIZE);
+    cycles[0] = TCA0.SINGLE.CNT - start;
+
+    start = TCA0.SINGLE.CNT;
+    crc32 = CRC32_UpdateBitwise(CRC32_INITIAL, benchmark_crc_data, BENCHMARK_CRC_SIZE);
+    cycles[1] = TCA0.SINGLE.CNT - start;
+
+    start = TCA0.SINGLE.CNT;
+    crc16 = CRC16_UpdateNibble(CRC16_INITIAL, benchmark_crc_data, BENCHMARK_CRC_SIZE);
+    cycles[2] = TCA0.SINGLE.CNT - start;
+
+    start = TCA0.SINGLE.CNT;
+    crc32 = CRC32_UpdateNibble(CRC32_INITIAL, benchmark_crc_data, BENCHMARK_CRC_SIZE);
+    cycles[3] = TCA0.SINGLE.CNT - start;
+
+    start = TCA0.SINGLE.CNT;
+    crc16 = CRC16_UpdateTable(CRC16_INITIAL, benchmark_crc_data, BENCHMARK_CRC_SIZE);
+    cycles[4] = TCA0.SINGLE.CNT - start;
+
+    start = TCA0.SINGLE.CNT;
+    crc32 = CRC32_UpdateTable(CRC32_INITIAL, benchmark_crc_data, BENCHMARK_CRC_SIZE);
+    cycles[5] = TCA0.SINGLE.CNT - start;
+
+    EXIT_CRITICAL(R);
+
+    (void) crc16;
+    (void) crc32;
+
+    FMT_PUTS("\r\nCRC cycles per byte:");
+    CRC_Benchmark_Print(PSTR("Bitwise"), cycles[0], cycles[1]);
+    CRC_Benchmark_Print(PSTR("Nibble"), cycles[2], cycles[3]);
+    CRC_Benchmark_Print(PSTR("Table"), cycles[4], cycles[5]);
+    FMT_PUTS("\r\n");
+}
+
+/*
+    Scheduler release test
+
+    Adds two tasks and checks how their next release is set. The early
+    task finishes well inside its period and must never skip a release
+    or overrun. The late task busy-waits for one and a half of its
+    periods, so every run overruns and drops one release, and it runs on
+    every second period of the original grid. The late task has the
+    earlier deadline, so the early task waits behind it for at most one
+    late run, which is shorter than its own period.
+
+    The tasks cannot be removed again, run this on its own.
+ */
+
+#define BENCHMARK_SCHED_EARLY_US 4000UL
+#define BENCHMARK_SCHED_LATE_US 1000UL
+#define BENCHMARK_SCHED_RUNS 50
+
+static timebase_t benchmark_sched_busy;
+
+static void Scheduler_Benchmark_Early(void)
+{
+}
+
+static void Scheduler_Benchmark_Late(void)
+{
+    timebase_t start = TIMEBASE_Now();
+
+    while (TIMEBASE_ELAPSED(start, TIMEBASE_Now()) < benchmark_sched_busy)
+    {
+    }
+}
+
+void Scheduler_Benchmark(void)
+{
+    scheduler_stats_t early;
+    scheduler_stats_t late;
+    int8_t early_id;
+    int8_t late_id;
+    bool passed;
+
+    benchmark_sched_busy = TIMEBASE_UsToTicks(BENCHMARK_SCHED_LATE_US * 3 / 2);
+    early_id = SCHEDULER_AddTaskUs(Scheduler_Benchmark_Early, BENCHMARK_SCHED_EARLY_US);
+    late_id = SCHEDULER_AddTaskUs(Scheduler_Benchmark_Late, BENCHMARK_SCHED_LATE_US);
+    if ((early_id < 0) || (late_id < 0))
+    {
+        FMT_PUTS("\r\nFailed : Scheduler test, no free task slot\r\n");
+        return;
+    }
+
+    do
+    {
+        SCHEDULER_RunOnce();
+        SCHEDULER_GetStats(early_id, &early);
+    } while (early.runs < BENCHMARK_SCHED_RUNS);
+    SCHEDULER_GetStats(late_id, &late);
+
+    passed = (early.skipped == 0) && (early.overruns == 0)
+        && (late.overruns == late.runs)
+        && ((uint32_t) late.skipped + 1 >= late.runs) && (late.skipped <= late.runs + 1);
+
+    if (passed)
+    {
+        FMT_PUTS("\r\nPassed : Scheduler test, ");
+    }
+    else
+    {
+        FMT_PUTS("\r\nFailed : Scheduler test, ");
+    }
+    FMT_PUTS("early runs ");
+    FMT_PutUnsigned(early.runs);
+    FMT_PUTS(" skipped ");
+    FMT_PutUnsigned(early.skipped);
+    FMT_PUTS(", late runs ");
+    FMT_PutUnsigned(late.runs);
+    FMT_PUTS(" skipped ");
+    FMT_PutUnsigned(late.skipped);
+    FMT_PUTS(" overruns ");
+    FMT_PutUnsigned(late.overruns);
+    FMT_PUTS("\r\n");
+}
+
+/*
+    Pin descriptor benchmark
+
+    Times BENCHMARK_PIN_LOOPS of each pin_descriptor.h operation on
+    BENCHMARK_PIN, once with the descriptor as a compile-time constant and
+    once with a descriptor the compiler cannot see through, so the
+    variable form computes the port and mask in every iteration. Reports
+    the cycles each operation adds per iteration, x10, against an empty
+    loop. Interrupts are off while measuring. The pin is left an output,
+    driven low.
+ */
+
+#define BENCHMARK_PIN PIN(E, 0)
+#define BENCHMARK_PIN_LOOPS 32
+
+static volatile pin_t benchmark_pin = BENCHMARK_PIN;
+
+/* Cycles of BENCHMARK_PIN_LOOPS iterations of op, the empty asm makes pin opaque in each one */
+#define BENCHMARK_PIN_LOOP(pin, op)                                                                                    \
+    ({                                                                                                                 \
+        uint16_t start = TCA0.SINGLE.CNT;                                                                              \
+        for (uint8_t i = 0; i < BENCHMARK_PIN_LOOPS; i++)                                                              \
+        {                                                                                                              \
+            __asm__ __volatile__("" : "+r"(pin) : : "memory");                                                         \
+            op;                                                                                                        \
+        }                                                                                                              \
+        (uint16_t)(TCA0.SINGLE.CNT - start);                                                                           \
+    })
+
+/* name is a PSTR() string */
+static void PinDescriptor_Benchmark_Print(const char *name, uint16_t constant, uint16_t variable, uint16_t baseline)
+{
+    FMT_PutString_P(name);
+    FMT_PutUnsigned((uint16_t)(constant - baseline) * 10U / BENCHMARK_PIN_LOOPS);
+    FMT_PutChar('/');
+    FMT_PutUnsigned((uint16_t)(variable - baseline) * 10U / BENCHMARK_PIN_LOOPS);
+}
+
+void PinDescriptor_Benchmark(void)
+{
+    pin_t pin = benchmark_pin;
+    uint16_t cycles[9];
+
+    PIN_CLEAR(BENCHMARK_PIN);
+    PIN_SET_OUTPUT(BENCHMARK_PIN);
+
+    ENTER_CRITICAL(R);
+    cycles[0] = BENCHMARK_PIN_LOOP(pin, (void) 0);
+    cycles[1] = BENCHMARK_PIN_LOOP(pin, PIN_SET(BENCHMARK_PIN));
+    cycles[2] = BENCHMARK_PIN_LOOP(pin, PIN_SET(pin));
+    cycles[3] = BENCHMARK_PIN_LOOP(pin, PIN_CLEAR(BENCHMARK_PIN));
+    cycles[4] = BENCHMARK_PIN_LOOP(pin, PIN_CLEAR(pin));
+    /* An even number of toggles, the pin stays low for the reads */
+    cycles[5] = BENCHMARK_PIN_LOOP(pin, PIN_TOGGLE(BENCHMARK_PIN));
+    cycles[6] = BENCHMARK_PIN_LOOP(pin, PIN_TOGGLE(pin));
+    cycles[7] = BENCHMARK_PIN_LOOP(pin, if (PIN_READ(BENCHMARK_PIN)) { __asm__ __volatile__("nop"); });
+    cycles[8] = BENCHMARK_PIN_LOOP(pin, if (PIN_READ(pin)) { __asm__ __volatile__("nop"); });
+    EXIT_CRITICAL(R);
+
+    FMT_PUTS("\r\nPin cycles x10, constant/variable:");
+    PinDescriptor_Benchmark_Print(PSTR(" set "), cycles[1], cycles[2], cycles[0]);
+    PinDescriptor_Benchmark_Print(PSTR(", clear "), cycles[3], cycles[4], cycles[0]);
+    PinDescriptor_Benchmark_Print(PSTR(", toggle "), cycles[5], cycles[6], cycles[0]);
+    PinDescriptor_Benchmark_Print(PSTR(", read "), cycles[7], cycles[8], cycles[0]);
+    FMT_PUTS("\r\n");
+}
+
+/*
+    Port interrupt benchmark
+
+    Measures the cycles from a pin edge to the callback or handler body on
+    PORTE, for the handler form chosen with BENCHMARK_PORT_HANDLER: 0 the
+    dispatcher, which needs PORTE_DISPATCH_ENABLE set to 1, 1
+    PORT_FAST_ISR(), 2 PORT_NAKED_ISR(). BENCHMARK_PORT_PIN is an output
+    with rising edge sensing, so driving it high requests the interrupt.
+    TCA0.CNT is read just before that write and first thing in the
+    callback or body. The difference includes the write, the pin
+    synchronizer, the interrupt response and the handler up to that read.
+
+    With the dispatcher, a second run also raises BENCHMARK_PORT_LOWER_PIN
+    in the same write, so its empty callback is dispatched first. Each run
+    is repeated BENCHMARK_RUNS times and the worst case is reported.
+ */
+
+#ifndef BENCHMARK_PORT_HANDLER
+#if PORTE_DISPATCH_ENABLE
+#define BENCHMARK_PORT_HANDLER 0
+#else
+#define BENCHMARK_PORT_HANDLER 1
+#endif
+#endif
+
+#if (BENCHMARK_PORT_HANDLER == 0) != (PORTE_DISPATCH_ENABLE != 0)
+#error BENCHMARK_PORT_HANDLER 0 needs PORTE_DISPATCH_ENABLE 1, the other handlers need it 0
+#endif
+
+#define BENCHMARK_PORT_PIN 1
+#define BENCHMARK_PORT_LOWER_PIN 0
+
+#if BENCHMARK_PORT_HANDLER == 2
+
+/* Stored by the naked handler, which can only keep the low byte of TCA0.CNT */
+volatile uint8_t benchmark_port_cnt_low;
+
+/* 0x0A20 is TCA0.SINGLE.CNTL. Reading it latches the high byte into TEMP,
+   which nothing reads while the benchmark waits. */
+PORT_NAKED_ISR(E, BENCHMARK_PORT_PIN, "lds r16, 0x0A20\n\tsts benchmark_port_cnt_low, r16")
+
+#else
+
+static volatile uint16_t benchmark_port_cnt;
+
+#if BENCHMARK_PORT_HANDLER == 0
+
+static void PortInterrupt_Benchmark_Callback(void)
+{
+    TIMEBASE_TEMP_SAVE();
+    benchmark_port_cnt = TCA0.SINGLE.CNT;
+    TIMEBASE_TEMP_RESTORE();
+}
+
+static void PortInterrupt_Benchmark_Lower(void)
+{
+}
+
+PORT_DISPATCH_TABLE(E, [BENCHMARK_PORT_LOWER_PIN] = PortInterrupt_Benchmark_Lower,
+                    [BENCHMARK_PORT_PIN] = PortInterrupt_Benchmark_Callback);
+
+#else
+
+PORT_FAST_ISR(E, BENCHMARK_PORT_PIN, {
+    TIMEBASE_TEMP_SAVE();
+    benchmark_port_cnt = TCA0.SINGLE.CNT;
+    TIMEBASE_TEMP_RESTORE();
+})
+
+#endif
+#endif
+
+static uint16_t PortInterrupt_Benchmark_Run(uint8_t mask)
+{
+    uint16_t worst = 0;
+
+    for (uint8_t run = 0; run < BENCHMARK_RUNS; run++)
+    {
+        uint16_t start;
+        uint16_t latency;
+
+        start = TCA0.SINGLE.CNT;
+        PORTE.OUTSET = mask;
+        while ((uint16_t)(TCA0.SINGLE.CNT - start) < BENCHMARK_LEAD_CYCLES)
+        {
+        }
+        PORTE.OUTCLR = mask;
+
+#if BENCHMARK_PORT_HANDLER == 2
+        latency = (uint8_t)(benchmark_port_cnt_low - (uint8_t) start);
+#else
+        latency = benchmark_port_cnt - start;
+#endif
+        if (latency > worst)
+        {
+            worst = latency;
+        }
+    }
+
+    return worst;
+}
+
+void PortInterrupt_Benchmark(void)
+{
+    const uint8_t mask = 1 << BENCHMARK_PORT_PIN;
+    const uint8_t lower = 1 << BENCHMARK_PORT_LOWER_PIN;
+
+    PORTE.OUTCLR = mask | lower;
+    PORTE.DIRSET = mask | lower;
+    PORTE_pin_set_isc(BENCHMARK_PORT_PIN, PORT_ISC_RISING_gc);
+    PORTE_pin_set_isc(BENCHMARK_PORT_LOWER_PIN, PORT_ISC_RISING_gc);
+
+#if BENCHMARK_PORT_HANDLER == 0
+    FMT_PUTS("\r\nPort interrupt cycles to callback, dispatcher ");
+    FMT_PutUnsigned(PortInterrupt_Benchmark_Run(mask));
+    FMT_PUTS(", behind a lower pin ");
+    FMT_PutUnsigned(PortInterrupt_Benchmark_Run(mask | lower));
+#elif BENCHMARK_PORT_HANDLER == 1
+    FMT_PUTS("\r\nPort interrupt cycles to body, PORT_FAST_ISR ");
+    FMT_PutUnsigned(PortInterrupt_Benchmark_Run(mask));
+#else
+    FMT_PUTS("\r\nPort interrupt cycles to body, PORT_NAKED_ISR ");
+    FMT_PutUnsigned(PortInterrupt_Benchmark_Run(mask));
+#endif
+    FMT_PUTS("\r\n");
+
+    PORTE_pin_set_isc(BENCHMARK_PORT_PIN, PORT_ISC_INTDISABLE_gc);
+    PORTE_pin_set_isc(BENCHMARK_PORT_LOWER_PIN, PORT_ISC_INTDISABLE_gc);
+}
+
+/*
+    CCP write benchmark
+
+    Times CLKCTRL_Initialize(), which uses the inline CCP_WRITE_IO(),
+    against the same nine writes through ccp_write_io(), and one NVM
+    command written with CCP_WRITE_SPM() against ccp_write_spm(). The
+    command is NVMCTRL_CMD_NONE_gc, which changes nothing. The cycles of
+    reading TCA0.CNT twice are subtracted. Interrupts are off while
+    measuring.
+
+    CLKCTRL_Initialize() writes the startup clock configuration, so run
+    this before the application changes the clock. The registers are
+    restored afterwards; a running 32.768 kHz crystal is restarted.
+ */
+
+static void CCP_Benchmark_ClockCall(void)
+{
+    ccp_write_io((void *) &CLKCTRL.MCLKCTRLA, 0x0);
+    ccp_write_io((void *) &CLKCTRL.MCLKCTRLB, 0x0);
+    ccp_write_io((void *) &CLKCTRL.MCLKLOCK, 0x0);
+    ccp_write_io((void *) &CLKCTRL.MCLKSTATUS, 0x0);
+    ccp_write_io((void *) &CLKCTRL.OSCHFCTRLA, 0xC);
+    ccp_write_io((void *) &CLKCTRL.OSCHFTUNE, 0x0);
+    ccp_write_io((void *) &CLKCTRL.OSC32KCTRLA, 0x0);
+    ccp_write_io((void *) &CLKCTRL.PLLCTRLA, 0x0);
+    ccp_write_io((void *) &CLKCTRL.XOSC32KCTRLA, 0x0);
+}
+
+void CCP_Benchmark(void)
+{
+    uint8_t mclkctrla = CLKCTRL.MCLKCTRLA;
+    uint8_t mclkctrlb = CLKCTRL.MCLKCTRLB;
+    uint8_t oschfctrla = CLKCTRL.OSCHFCTRLA;
+    uint8_t oschftune = CLKCTRL.OSCHFTUNE;
+    uint8_t osc32kctrla = CLKCTRL.OSC32KCTRLA;
+    uint8_t pllctrla = CLKCTRL.PLLCTRLA;
+    uint8_t xosc32kctrla = CLKCTRL.XOSC32KCTRLA;
+    uint16_t cycles[5];
+    uint16_t start;
+
+    while (NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm | NVMCTRL_FBUSY_bm))
+    {
+    }
+
+    ENTER_CRITICAL(R);
+
+    start = TCA0.SINGLE.CNT;
+    cycles[0] = TCA0.SINGLE.CNT - start;
+
+    start = TCA0.SINGLE.CNT;
+    CLKCTRL_Initialize();
+    cycles[1] = TCA0.SINGLE.CNT - start;
+
+    start = TCA0.SINGLE.CNT;
+    CCP_Benchmark_ClockCall();
+    cycles[2] = TCA0.SINGLE.CNT - start;
+
+    start = TCA0.SINGLE.CNT;
+    CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+    cycles[3] = TCA0.SINGLE.CNT - start;
+
+    start = TCA0.SINGLE.CNT;
+    ccp_write_spm((void *) &NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+    cycles[4] = TCA0.SINGLE.CNT - start;
+
+    CCP_WRITE_IO(CLKCTRL.XOSC32KCTRLA, xosc32kctrla);
+    CCP_WRITE_IO(CLKCTRL.PLLCTRLA, pllctrla);
+    CCP_WRITE_IO(CLKCTRL.OSC32KCTRLA, osc32kctrla);
+    CCP_WRITE_IO(CLKCTRL.OSCHFTUNE, oschftune);
+    CCP_WRITE_IO(CLKCTRL.OSCHFCTRLA, oschfctrla);
+    CCP_WRITE_IO(CLKCTRL.MCLKCTRLB, mclkctrlb);
+    CCP_WRITE_IO(CLKCTRL.MCLKCTRLA, mclkctrla);
+
+    EXIT_CRITICAL(R);
+
+    FMT_PUTS("\r\nCCP cycles, inline/call: CLKCTRL_Initialize ");
+    FMT_PutUnsigned(cycles[1] - cycles[0]);
+    FMT_PutChar('/');
+    FMT_PutUnsigned(cycles[2] - cycles[0]);
+    FMT_PUTS(", NVM command ");
+    FMT_PutUnsigned(cycles[3] - cycles[0]);
+    FMT_PutChar('/');
+    FMT_PutUnsigned(cycles[4] - cycles[0]);
+    FMT_PUTS("\r\n");
+}
+
+/*
+    NVM wait strategy benchmark
+
+    Writes BENCHMARK_NVM_EEPROM_SIZE EEPROM bytes one at a time, then every
+    page of the event log, under NVM_WAIT_POLL, NVM_WAIT_YIELD and
+    NVM_WAIT_SLEEP. Reports the total time of each and the time the yield
+    function got, which is the CPU time left to the main loop while
+    waiting. The yield function busy-waits BENCHMARK_NVM_YIELD_CYCLES per
+    call and counts them. The watchdog is polled after each byte and page.
+
+    The EEPROM bytes sit just below the Flash CRC reference. The event log
+    is left erased and is initialized again, so its records are lost. The
+    wait strategy is left at NVM_WAIT_POLL, the default.
+ */
+
+#define BENCHMARK_NVM_EEPROM_SIZE 32
+#define BENCHMARK_NVM_EEPROM_ADDRESS (FLASH_CRC_REFERENCE_EEPROM_ADDRESS - BENCHMARK_NVM_EEPROM_SIZE)
+#define BENCHMARK_NVM_YIELD_CYCLES 100
+
+static uint32_t benchmark_nvm_yield_ticks;
+static uint8_t benchmark_nvm_page[PROGMEM_PAGE_SIZE];
+
+static void NvmWait_Benchmark_Yield(void)
+{
+    uint16_t start = TCA0.SINGLE.CNT;
+    uint16_t elapsed;
+
+    do
+    {
+        elapsed = TCA0.SINGLE.CNT - start;
+    } while (elapsed < BENCHMARK_NVM_YIELD_CYCLES);
+    benchmark_nvm_yield_ticks += elapsed;
+}
+
+/* name is a PSTR() string */
+static void NvmWait_Benchmark_Run(nvmctrl_wait_mode_t mode, const char *name)
+{
+    timebase_t start;
+    timebase_t eeprom;
+    timebase_t eeprom_yield;
+    timebase_t flash;
+
+    FLASH_SetWaitStrategy(mode, NvmWait_Benchmark_Yield);
+
+    benchmark_nvm_yield_ticks = 0;
+    start = TIMEBASE_Now();
+    for (uint8_t i = 0; i < BENCHMARK_NVM_EEPROM_SIZE; i++)
+    {
+        FLASH_WriteEepromByte(BENCHMARK_NVM_EEPROM_ADDRESS + i, i);
+        WATCHDOG_Poll();
+    }
+    FLASH_WaitReady();
+    eeprom = TIMEBASE_ELAPSED(start, TIMEBASE_Now());
+    eeprom_yield = benchmark_nvm_yield_ticks;
+
+    benchmark_nvm_yield_ticks = 0;
+    start = TIMEBASE_Now();
+    for (uint8_t page = 0; page < EVENT_LOG_PAGES; page++)
+    {
+        FLASH_WriteFlashPage(EVENT_LOG_START_ADDRESS + (flash_adr_t) page * PROGMEM_PAGE_SIZE, benchmark_nvm_page);
+        WATCHDOG_Poll();
+    }
+    FLASH_WaitReady();
+    flash = TIMEBASE_ELAPSED(start, TIMEBASE_Now());
+
+    FMT_PUTS("\r\n");
+    FMT_PutString_P(name);
+    FMT_PUTS(": EEPROM ");
+    FMT_PutUnsigned(TIMEBASE_TicksToUs(eeprom));
+    FMT_PutChar('/');
+    FMT_PutUnsigned(TIMEBASE_TicksToUs(eeprom_yield));
+    FMT_PUTS(", flash ");
+    FMT_PutUnsigned(TIMEBASE_TicksToUs(flash));
+    FMT_PutChar('/');
+    FMT_PutUnsigned(TIMEBASE_TicksToUs(benchmark_nvm_yield_ticks));
+}
+
+void NvmWait_Benchmark(void)
+{
+    /* Pages of 0xFF read back as erased, so the event log starts over empty */
+    memset(benchmark_nvm_page, 0xFF, sizeof (benchmark_nvm_page));
+
+    FMT_PUTS("\r\nNVM write us, total/yield:");
+    NvmWait_Benchmark_Run(NVM_WAIT_POLL, PSTR("Poll"));
+    NvmWait_Benchmark_Run(NVM_WAIT_YIELD, PSTR("Yield"));
+    NvmWait_Benchmark_Run(NVM_WAIT_SLEEP, PSTR("Sleep"));
+    FMT_PUTS("\r\n");
+
+    FLASH_SetWaitStrategy(NVM_WAIT_POLL, NULL);
+    EVENT_LOG_Initialize();
+}
+
+/*
+    Sleep wake-up benchmark
+
+    Sleeps in idle and in standby until TCA0 CMP1 fires, with the CMP1
+    handler of the CPUINT benchmark reading CNT minus CMP1 first thing;
+    CMP0 belongs to the scheduler. The entry latency measured awake is
+    subtracted, which leaves the delay the sleep mode adds. In the worst
+    of BENCHMARK_RUNS runs it must not exceed the wake-up time the power
+    manager budgets, the start-up time plus POWER_WAKEUP_CYCLES.
+
+    The sleep mode is written directly, bypassing the power manager locks,
+    and a run is repeated when another interrupt woke the CPU first.
+    Power-down stops TCA0 and is not measured.
+ */
+
+static uint16_t PowerWake_Benchmark_Run(uint8_t smode)
+{
+    uint16_t worst = 0;
+    bool woken;
+
+    while (!USART1_IsTxDone())
+    {
+    }
+
+    for (uint8_t run = 0; run < BENCHMARK_RUNS; run++)
+    {
+        do
+        {
+            benchmark_cmp1_done = false;
+
+            ENTER_CRITICAL(R);
+            TCA0.SINGLE.CMP1 = TCA0.SINGLE.CNT + BENCHMARK_LEAD_CYCLES;
+            TCA0.SINGLE.INTFLAGS = TCA_SINGLE_CMP1_bm;
+            TCA0.SINGLE.INTCTRL |= TCA_SINGLE_CMP1_bm;
+            SLPCTRL.CTRLA = smode | SLPCTRL_SEN_bm;
+            sei();
+            sleep_cpu();
+            woken = benchmark_cmp1_done;
+            SLPCTRL.CTRLA = SLPCTRL_SMODE_IDLE_gc;
+            EXIT_CRITICAL(R);
+
+            while (!benchmark_cmp1_done)
+            {
+            }
+        } while (!woken);
+
+        if (benchmark_cmp1_latency > worst)
+        {
+            worst = benchmark_cmp1_latency;
+        }
+    }
+
+    return worst;
+}
+
+void PowerWake_Benchmark(void)
+{
+    uint16_t awake = CPUINT_Benchmark_Run(false);
+    uint16_t idle = PowerWake_Benchmark_Run(SLPCTRL_SMODE_IDLE_gc);
+    uint16_t standby = PowerWake_Benchmark_Run(SLPCTRL_SMODE_STDBY_gc);
+
+    idle = (idle > awake) ? idle - awake : 0;
+    standby = (standby > awake) ? standby - awake : 0;
+
+    if ((idle <= TIMEBASE_UsToTicks(POWER_WAKEUP_US_IDLE) + POWER_WAKEUP_CYCLES)
+        && (standby <= TIMEBASE_UsToTicks(POWER_WAKEUP_US_STANDBY) + POWER_WAKEUP_CYCLES))
+    {
+        FMT_PUTS("\r\nPassed : Sleep wake-up, cycles: awake ");
+    }
+    else
+    {
+        FMT_PUTS("\r\nFailed : Sleep wake-up, cycles: awake ");
+    }
+    FMT_PutUnsigned(awake);
+    FMT_PUTS(", idle adds ");
+    FMT_PutUnsigned(idle);
+    FMT_PUTS(" of ");
+    FMT_PutUnsigned(TIMEBASE_UsToTicks(POWER_WAKEUP_US_IDLE) + POWER_WAKEUP_CYCLES);
+    FMT_PUTS(", standby adds ");
+    FMT_PutUnsigned(standby);
+    FMT_PUTS(" of ");
+    FMT_PutUnsigned(TIMEBASE_UsToTicks(POWER_WAKEUP_US_STANDBY) + POWER_WAKEUP_CYCLES);
+    FMT_PUTS("\r\n");
+}
+
+/*
+    Pin manager benchmark
+
+    Times PIN_MANAGER_Initialize(), call and return included, with
+    interrupts off. It puts every pin back to its startup configuration,
+    so pins set up by the application or by other benchmarks are reset.
+ */
+
+void PinManager_Benchmark(void)
+{
+    uint16_t cycles;
+    uint16_t start;
+
+    ENTER_CRITICAL(R);
+    start = TCA0.SINGLE.CNT;
+    PIN_MANAGER_Initialize();
+    cycles = TCA0.SINGLE.CNT - start;
+    EXIT_CRITICAL(R);
+
+    FMT_PUTS("\r\nPIN_MANAGER_Initialize cycles: ");
+    FMT_PutUnsigned(cycles);
+    FMT_PUTS("\r\n");
+}
+
+#endif
+/**
+End of File
+ */
@@ -0,0 +1,75 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef BENCHMARK_EXAMPLE_H
+#define BENCHMARK_EXAMPLE_H
+
+/**
+ * Benchmarks are compiled only with BENCHMARK_ENABLE set to 1, they take
+ * over peripherals and interrupt vectors the application may use.
+ */
+#ifndef BENCHMARK_ENABLE
+#define BENCHMARK_ENABLE 0
+#endif
+
+#if BENCHMARK_ENABLE
+void CPUINT_Benchmark(void);
+void RingBuffer_Benchmark(void);
+void Format_Benchmark(void);
+void CriticalSection_Benchmark(void);
+void Watchdog_Benchmark(void);
+void CpuRegisters_Benchmark(void);
+void Scheduler_Benchmark(void);
+void CRC_Benchmark(void);
+void PinDescriptor_Benchmark(void);
+void PortInterrupt_Benchmark(void);
+void CCP_Benchmark(void);
+void NvmWait_Benchmark(void);
+void PowerWake_Benchmark(void);
+void PinManager_Benchmark(void);
+#endif
+
+#endif /* BENCHMARK_EXAMPLE_H */
+/**
+End of File
+ */
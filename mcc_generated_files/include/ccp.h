@@ -86,6 +86,40 @@ static inline void ccp_write_spm(void *addr, uint8_t value)
 
 /** @} */
 
+/**
+ * \brief Write to a CCP-protected 8-bit register at a compile-time constant address
+ *
+ * Expands to an OUT to CCP followed directly by an STS to the register, so the
+ * write always lands inside the 4-instruction CCP window. Unlike
+ * ccp_write_io() there is no call, no RAMPZ update and no Z load, and the
+ * key register can be shared between consecutive writes.
+ *
+ * \param reg The register itself, e.g. CLKCTRL.MCLKCTRLA, not its address
+ * \param magic CCP_IOREG_gc or CCP_SPM_gc
+ * \param value Value to be written
+ *
+ * \note IAR has no equivalent of the "n" constraint, there the macro falls
+ *       back to protected_write_io().
+ */
+#if defined(__GNUC__)
+#define CCP_PROTECTED_WRITE(reg, magic, value)                                                                       \
+	__asm__ __volatile__("out %[ccp], %[key]"                                                                        \
+	                     "\n\t"                                                                                     \
+	                     "sts %[ioreg], %[val]"                                                                      \
+	                     :                                                                                           \
+	                     : [ccp] "I"(_SFR_IO_ADDR(CCP)), [key] "r"((uint8_t)(magic)), [ioreg] "n"(_SFR_MEM_ADDR(reg)), \
+	                       [val] "r"((uint8_t)(value))                                                               \
+	                     : "memory")
+#else
+#define CCP_PROTECTED_WRITE(reg, magic, value) protected_write_io((void *)&(reg), (magic), (value))
+#endif
+
+/** Inline form of ccp_write_io() for a register known at compile time */
+#define CCP_WRITE_IO(reg, value) CCP_PROTECTED_WRITE(reg, CCP_IOREG_gc, value)
+
+/** Inline form of ccp_write_spm() for a register known at compile time */
+#define CCP_WRITE_SPM(reg, value) CCP_PROTECTED_WRITE(reg, CCP_SPM_gc, value)
+
 #ifdef __cplusplus
 }
 #endif
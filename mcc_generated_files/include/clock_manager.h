@@ -0,0 +1,103 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef CLOCK_MANAGER_H_INCLUDED
+#define CLOCK_MANAGER_H_INCLUDED
+
+#include "../include/utils/compiler.h"
+#include "../include/clock.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup doc_driver_clock_manager Clock manager
+ *
+ * Changes the internal high-frequency oscillator and the main clock
+ * prescaler at run-time. The peripheral clock frequency in Hz is kept in
+ * clock_frequency; drivers deriving baud rates, timer periods or timeouts
+ * from the clock register a consumer, which is called after every change
+ * to recompute them. F_CPU only holds the frequency after reset.
+ *
+ * The PLL of the AVR DA feeds TCD only, it can never clock the CPU. Its
+ * output frequency is kept in clock_pll_frequency.
+ *
+ *@{
+ */
+
+/** Largest number of registered consumers */
+#ifndef CLOCK_CONSUMER_MAX
+#define CLOCK_CONSUMER_MAX 8
+#endif
+
+/** Prescaler argument for an undivided main clock */
+#define CLOCK_PRESCALER_NONE 0
+
+/** Prescaler argument for a divided main clock, div is one of the CLKCTRL_PDIV_xX_gc values */
+#define CLOCK_PRESCALER(div) ((div) | CLKCTRL_PEN_bm)
+
+/** Datatype for a consumer of the peripheral clock */
+typedef void (*clock_consumer_t)(uint32_t frequency);
+
+/** Peripheral clock frequency in Hz. Only changed by CLOCK_SetFrequency(). */
+extern volatile uint32_t clock_frequency;
+
+/** PLL output frequency in Hz, 0 while the PLL is off */
+extern volatile uint32_t clock_pll_frequency;
+
+int8_t CLOCK_RegisterConsumer(clock_consumer_t consumer);
+
+int8_t CLOCK_SetFrequency(uint8_t frqsel, uint8_t prescaler);
+
+int8_t CLOCK_SetPll(uint8_t mulfac);
+
+uint32_t CLOCK_GetFrequency(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CLOCK_MANAGER_H_INCLUDED */
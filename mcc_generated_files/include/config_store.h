@@ -0,0 +1,116 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef CONFIG_STORE_H_INCLUDED
+#define CONFIG_STORE_H_INCLUDED
+
+#include "../include/utils/compiler.h"
+#include "../include/nvmctrl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief A/B configuration store
+ *
+ * The configuration lives in two flash slots. A save always goes to the slot
+ * that does not hold the current configuration, so the current copy is never
+ * touched while the new one is written. Each slot ends with a header holding
+ * a sequence number, the payload length, the payload CRC16 and a commit
+ * marker. The marker is the last thing programmed, so a power cut at any point
+ * of a save leaves either the old slot or the new one valid:
+ *
+ * 1. The header page of the target slot is erased, invalidating it.
+ * 2. The payload is programmed with the page APIs.
+ * 3. The header is programmed into the erased header area, marker last.
+ *
+ * At boot, and again before every save, the newest committed slot whose
+ * payload CRC verifies is picked; the other slot is used if the newest one
+ * does not verify. A save therefore never erases the only good copy.
+ *
+ * The slots are rewritten at run-time, so they are placed in the APPDATA
+ * section, outside the range covered by the Flash CRC diagnostic.
+ */
+
+/** Size of one slot, a multiple of PROGMEM_PAGE_SIZE */
+#ifndef CONFIG_STORE_SLOT_SIZE
+#define CONFIG_STORE_SLOT_SIZE (PROGMEM_PAGE_SIZE)
+#endif
+
+/** Flash address of slot A, page aligned, at the start of APPDATA */
+#ifndef CONFIG_STORE_SLOT_A_ADDRESS
+#define CONFIG_STORE_SLOT_A_ADDRESS (FLASH_APPDATA_START)
+#endif
+
+/** Flash address of slot B, page aligned */
+#ifndef CONFIG_STORE_SLOT_B_ADDRESS
+#define CONFIG_STORE_SLOT_B_ADDRESS (CONFIG_STORE_SLOT_A_ADDRESS + CONFIG_STORE_SLOT_SIZE)
+#endif
+
+/** Bytes of a slot taken by the header */
+#define CONFIG_STORE_HEADER_SIZE 10
+
+/** Largest configuration a slot can hold */
+#define CONFIG_STORE_PAYLOAD_MAX (CONFIG_STORE_SLOT_SIZE - CONFIG_STORE_HEADER_SIZE)
+
+/** Datatype for return status of configuration store operations */
+typedef enum {
+    CONFIG_STORE_OK    = 0, ///< Operation completed.
+    CONFIG_STORE_EMPTY = 1, ///< No slot holds a committed configuration.
+    CONFIG_STORE_ERROR = 2, ///< Programming failed or no slot verified.
+} config_store_status_t;
+
+void CONFIG_STORE_Initialize(void);
+
+config_store_status_t CONFIG_STORE_Load(uint8_t *data, uint16_t size);
+
+config_store_status_t CONFIG_STORE_Save(const uint8_t *data, uint16_t size);
+
+uint32_t CONFIG_STORE_GetSequence(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_STORE_H_INCLUDED */
@@ -58,6 +58,21 @@ extern "C" {
   */
 int8_t CPUINT_Initialize();
 
+/**
+ * \brief Make one interrupt vector level 1 (high priority)
+ *
+ * \param vect Vector name, e.g. TCB0_INT_vect
+ */
+#define CPUINT_SET_LEVEL1(vect) CPUINT_SetLevel1Vector(vect##_num)
+
+void CPUINT_SetLevel1Vector(uint8_t vector_num);
+
+void CPUINT_SetLevel0Priority(uint8_t vector_num);
+
+void CPUINT_SetRoundRobin(bool enable);
+
+void CPUINT_SetCompactVectorTable(bool enable);
+
 #ifdef __cplusplus
 }
 #endif
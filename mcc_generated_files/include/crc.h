@@ -0,0 +1,120 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef CRC_H_INCLUDED
+#define CRC_H_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief CRC implementation variants
+ *
+ * Approximate cost per byte on the AVR core, counted from the instruction
+ * sequences of each variant (table reads use LPM, loop overhead excluded).
+ * CRC_Benchmark() in examples/benchmark_example.c measures all six on target:
+ *
+ * Variant     | CRC16           | CRC32            | Table size (CRC16/CRC32)
+ * ------------|-----------------|------------------|-------------------------
+ * CRC_BITWISE | ~65 cycles/byte | ~115 cycles/byte | none
+ * CRC_NIBBLE  | ~40 cycles/byte | ~60 cycles/byte  | 32 / 64 bytes
+ * CRC_TABLE   | ~18 cycles/byte | ~30 cycles/byte  | 512 / 1024 bytes
+ */
+#define CRC_BITWISE 0
+#define CRC_NIBBLE  1
+#define CRC_TABLE   2
+
+/** Variant compiled in, one of CRC_BITWISE, CRC_NIBBLE or CRC_TABLE */
+#ifndef CRC_IMPLEMENTATION
+#define CRC_IMPLEMENTATION CRC_TABLE
+#endif
+
+/** Also compile every variant under its own name, for the CRC benchmark. Costs the flash of all tables. */
+#ifndef CRC_ALL_VARIANTS
+#if defined(BENCHMARK_ENABLE) && BENCHMARK_ENABLE
+#define CRC_ALL_VARIANTS 1
+#else
+#define CRC_ALL_VARIANTS 0
+#endif
+#endif
+
+/** Initial value of CRC-16/CCITT (polynomial 0x1021, MSB first, no final XOR) */
+#define CRC16_INITIAL 0xFFFFU
+
+/** Initial value of CRC-32 (polynomial 0x04C11DB7 reflected, final value is inverted) */
+#define CRC32_INITIAL 0xFFFFFFFFUL
+
+/** Final step of CRC-32, applied once after the last byte */
+#define CRC32_FINAL(crc) (~(crc))
+
+uint16_t CRC16_UpdateByte(uint16_t crc, uint8_t data);
+
+uint16_t CRC16_Update(uint16_t crc, const uint8_t *data, size_t size);
+
+uint32_t CRC32_UpdateByte(uint32_t crc, uint8_t data);
+
+uint32_t CRC32_Update(uint32_t crc, const uint8_t *data, size_t size);
+
+#if CRC_ALL_VARIANTS
+uint16_t CRC16_UpdateBitwise(uint16_t crc, const uint8_t *data, size_t size);
+
+uint16_t CRC16_UpdateNibble(uint16_t crc, const uint8_t *data, size_t size);
+
+uint16_t CRC16_UpdateTable(uint16_t crc, const uint8_t *data, size_t size);
+
+uint32_t CRC32_UpdateBitwise(uint32_t crc, const uint8_t *data, size_t size);
+
+uint32_t CRC32_UpdateNibble(uint32_t crc, const uint8_t *data, size_t size);
+
+uint32_t CRC32_UpdateTable(uint32_t crc, const uint8_t *data, size_t size);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRC_H_INCLUDED */
@@ -0,0 +1,97 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef DEBOUNCE_H_INCLUDED
+#define DEBOUNCE_H_INCLUDED
+
+#include "../include/utils/compiler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup doc_driver_debounce Debounce
+ *
+ * Debounces every pin of the first DEBOUNCE_PORT_COUNT ports at once. Each
+ * tick reads VPORTx.IN as a whole byte and advances a 2-bit vertical counter
+ * per pin, held as two bytes per port, so the 8 pins of a port are
+ * handled by a handful of byte operations and the cost per tick does not
+ * depend on how many pins are used. A pin changes its debounced state after
+ * DEBOUNCE_SAMPLES consecutive ticks at the new level; the change is also
+ * recorded in the rising and falling edge masks.
+ *
+ * DEBOUNCE_Tick() is meant to be called from a periodic timer ISR. It costs
+ * about 20 cycles per port on AVRxt (about 140 cycles for all seven ports),
+ * counted from the instruction sequence.
+ *
+ * Ports are numbered as in pin_descriptor.h, 0 for PORTA.
+ *
+ *@{
+ */
+
+/** Number of ports debounced, starting at PORTA */
+#ifndef DEBOUNCE_PORT_COUNT
+#define DEBOUNCE_PORT_COUNT 7
+#endif
+
+/** Consecutive equal samples needed for a change, fixed by the 2-bit counters */
+#define DEBOUNCE_SAMPLES 4
+
+void DEBOUNCE_Initialize(void);
+
+void DEBOUNCE_Tick(void);
+
+uint8_t DEBOUNCE_GetState(uint8_t port);
+
+uint8_t DEBOUNCE_GetRising(uint8_t port);
+
+uint8_t DEBOUNCE_GetFalling(uint8_t port);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBOUNCE_H_INCLUDED */
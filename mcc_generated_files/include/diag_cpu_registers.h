@@ -0,0 +1,135 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef DIAG_CPU_REGISTERS_H_INCLUDED
+#define DIAG_CPU_REGISTERS_H_INCLUDED
+
+/**
+ * \defgroup doc_driver_diag_cpu_registers CPU register test
+ *
+ * IEC 60730 class B self-test of r0-r31, the SREG flags, SP, RAMPZ and the
+ * X/Y/Z addressing modes, in src/diag_cpu_registers.S. GCC only.
+ *
+ * DIAG_CPU_RegistersStartup() runs the whole test before main(), from
+ * DIAG_OnStartup() in .init1. It only needs the stack, which the hardware
+ * sets up at reset, and leaves r1 cleared. On failure it jumps to
+ * DIAG_CPU_RegistersFailed(), a weak function that halts with interrupts
+ * off; define it to drive outputs to a safe state first.
+ *
+ * DIAG_CPU_Registers_Step() runs the next of DIAG_CPU_REGISTERS_SLICES
+ * slices at run time, preserving all state the calling convention
+ * requires. Each slice runs with interrupts off. A failing slice returns
+ * CPU_REGISTERS_ERROR and latches it: later steps return it without
+ * testing until DIAG_CPU_Registers_ClearError(), so a passing pass cannot
+ * hide the failure. The run-time test does not call
+ * DIAG_CPU_RegistersFailed(), the caller decides how to react.
+ *
+ * Cycles, counted from the AVRxt instruction timings on the passing path,
+ * call and return of the step included:
+ *
+ * Slice | Registers               | Step cycles | Interrupts off
+ * ----- | ----------------------- | ----------- | --------------
+ * 0     | r0-r15                  | 252         | 156
+ * 1     | r16-r31                 | 252         | 195
+ * 2     | SREG                    | 111         | 64
+ * 3     | SP, RAMPZ, X/Y/Z        | 133         | 77
+ *
+ * A pass is 748 cycles, 31 us at 24 MHz. CpuRegisters_Benchmark() in
+ * the benchmark examples measures the steps on the target.
+ *
+ *@{
+ */
+
+/** Test passed */
+#define CPU_REGISTERS_OK 0
+
+/** Test failed */
+#define CPU_REGISTERS_ERROR 1
+
+/** Slices of the pass are left to run */
+#define CPU_REGISTERS_IN_PROGRESS 2
+
+/** Slices in one run-time pass */
+#define DIAG_CPU_REGISTERS_SLICES 4
+
+/** Longest DIAG_CPU_Registers_Step() in CPU cycles, for budgeting */
+#define DIAG_CPU_REGISTERS_STEP_CYCLES_MAX 252
+
+/** Longest time a slice keeps interrupts off, in CPU cycles */
+#define DIAG_CPU_REGISTERS_IRQ_OFF_CYCLES_MAX 195
+
+/** RAMPZ bits in use, bit 16 of flash addresses on the 128 KB devices */
+#ifndef DIAG_CPU_RAMPZ_MASK
+#define DIAG_CPU_RAMPZ_MASK 0x01
+#endif
+
+#if !defined(__ASSEMBLER__)
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Datatype for the CPU_REGISTERS_ status codes */
+typedef uint8_t diag_cpu_status_t;
+
+void DIAG_CPU_RegistersStartup(void);
+
+void DIAG_CPU_RegistersFailed(void) __attribute__((noreturn));
+
+diag_cpu_status_t DIAG_CPU_Registers_Step(void);
+
+diag_cpu_status_t DIAG_CPU_Registers_GetStatus(void);
+
+void DIAG_CPU_Registers_ClearError(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !__ASSEMBLER__ */
+
+/** @} */
+
+#endif /* DIAG_CPU_REGISTERS_H_INCLUDED */
@@ -0,0 +1,121 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef EVENT_LOG_H_INCLUDED
+#define EVENT_LOG_H_INCLUDED
+
+#include "../include/utils/compiler.h"
+#include "../include/nvmctrl.h"
+#include "../include/config_store.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Flash-backed circular event log
+ *
+ * Events are appended as fixed-size records to a ring of flash pages. Once
+ * the cursor is EVENT_LOG_ERASE_AHEAD bytes into a page, the next append
+ * starts erasing the following page and returns without waiting for it. This
+ * drops the oldest page of events once the ring has wrapped. Every record
+ * carries a sequence number and a CRC16, so torn records from a power cut are
+ * recognized and skipped.
+ *
+ * An append programs one record at the cursor. The erase runs in the
+ * background while appends are further apart than one page erase, so the
+ * append crossing into the next page does not stall on it. If the erase
+ * could not be started before, because the controller stayed busy, the page
+ * is erased as the cursor enters it. At boot EVENT_LOG_Initialize() locates
+ * the cursor with a binary search over the first record of each page and a
+ * second one over the records of the newest page.
+ *
+ * The log area is rewritten at run-time, so it is placed in the APPDATA
+ * section, outside the range covered by the Flash CRC diagnostic.
+ */
+
+/** Number of flash pages in the ring, at least 2 */
+#ifndef EVENT_LOG_PAGES
+#define EVENT_LOG_PAGES 4
+#endif
+
+/** Flash address of the first page of the ring, page aligned. Placed in APPDATA after the configuration store by default. */
+#ifndef EVENT_LOG_START_ADDRESS
+#define EVENT_LOG_START_ADDRESS (CONFIG_STORE_SLOT_B_ADDRESS + CONFIG_STORE_SLOT_SIZE)
+#endif
+
+/** Offset into the current page from which the next page is erased ahead of the cursor */
+#ifndef EVENT_LOG_ERASE_AHEAD
+#define EVENT_LOG_ERASE_AHEAD (PROGMEM_PAGE_SIZE / 2)
+#endif
+
+/** Size of one record in flash */
+#define EVENT_LOG_RECORD_SIZE 16
+
+/** Number of records in one page */
+#define EVENT_LOG_RECORDS_PER_PAGE (PROGMEM_PAGE_SIZE / EVENT_LOG_RECORD_SIZE)
+
+/** Event record as stored in flash. check must stay the last member. */
+typedef struct {
+    uint32_t sequence;    ///< Incremented for every record slot, never reused.
+    uint32_t timestamp;   ///< Time of the event, in units chosen by the application.
+    uint8_t  source;      ///< Module reporting the event.
+    uint8_t  code;        ///< Event or fault code within the source.
+    uint16_t detail;      ///< Additional information, meaning depends on source and code.
+    uint8_t  reserved[2]; ///< Written as 0xFF.
+    uint16_t check;       ///< CRC16 of all previous members.
+} event_log_record_t;
+
+nvmctrl_status_t EVENT_LOG_Initialize(void);
+
+nvmctrl_status_t EVENT_LOG_Append(uint32_t timestamp, uint8_t source, uint8_t code, uint16_t detail);
+
+bool EVENT_LOG_Read(uint16_t age, event_log_record_t *record);
+
+uint32_t EVENT_LOG_GetSequence(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_LOG_H_INCLUDED */
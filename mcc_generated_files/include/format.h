@@ -0,0 +1,98 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef FORMAT_H_INCLUDED
+#define FORMAT_H_INCLUDED
+
+#include "../include/utils/compiler.h"
+#include <avr/pgmspace.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup doc_driver_format Compact formatter
+ *
+ * Text output without vfprintf. Each call formats one item into a few
+ * bytes of stack and queues them in the USART1 transmit buffer, following
+ * USART1_TX_POLICY when it is full. There is no format string to parse at
+ * run time and nothing is allocated.
+ *
+ * Decimal conversion subtracts powers of ten from a table in flash
+ * instead of dividing, a 32-bit division by 10 is a library call of
+ * several hundred cycles per digit.
+ *
+ * \code
+ * FMT_PUTS("\r\nPassed : Clock test, ");
+ * FMT_PutSigned(deviation);
+ * FMT_PUTS(" ppm\r\n");
+ * \endcode
+ *
+ *@{
+ */
+
+/** Queue a string literal, kept in flash */
+#define FMT_PUTS(s) FMT_PutString_P(PSTR(s))
+
+void FMT_PutChar(char c);
+
+void FMT_PutString(const char *s);
+
+void FMT_PutString_P(const char *s);
+
+void FMT_PutUnsigned(uint32_t value);
+
+void FMT_PutSigned(int32_t value);
+
+void FMT_PutFixed(int32_t value, uint8_t decimals);
+
+void FMT_PutHex(uint32_t value, uint8_t digits);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FORMAT_H_INCLUDED */
@@ -0,0 +1,143 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef ISR_PROFILER_H_INCLUDED
+#define ISR_PROFILER_H_INCLUDED
+
+/**
+ * \defgroup doc_driver_utils_isr_profiler ISR profiler
+ * \ingroup doc_driver_utils_interrupts
+ *
+ * Optional instrumentation of every ISR() handler. With ISR_PROFILER_ENABLE
+ * set to 1 in the project defines, interrupt_avr8.h includes this file
+ * through the ISR_CUSTOM_H hook and ISR() wraps the handler body: TCB1.CNT
+ * is sampled before and after it, and the duration goes into a slot of a
+ * small SRAM table holding count, minimum, maximum and total cycles of one
+ * vector. Slots are assigned on the first interrupt of a vector and cached
+ * in the handler, so recording costs no search. Without the define none of
+ * this is compiled.
+ *
+ * TCB1 free-runs at CLK_PER/1 with a period of 65536 cycles. Its own
+ * interrupt is the latency probe: it fires at a known count, and the count
+ * read on entry is how long a level 0 interrupt had to wait for other
+ * handlers and critical sections. The largest value is kept.
+ *
+ * Durations include the wrapper itself, about 20 cycles. Handlers declared
+ * with ISR_NAKED must use ISR_UNPROFILED(), a naked handler has no
+ * prologue for the wrapper to live in.
+ *
+ *@{
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of vectors that can be profiled */
+#ifndef ISR_PROFILER_SLOTS
+#define ISR_PROFILER_SLOTS 8
+#endif
+
+/** Profile of one vector, durations in CLK_PER cycles */
+typedef struct {
+	uint8_t  vector; ///< Vector number, 0 for an unused slot
+	uint32_t count;  ///< Number of interrupts
+	uint16_t min;    ///< Shortest duration
+	uint16_t max;    ///< Longest duration
+	uint32_t total;  ///< Sum of all durations, average is total / count
+} isr_profile_t;
+
+void ISR_PROFILER_Initialize(void);
+
+void ISR_PROFILER_Record(isr_profile_t **slot, uint8_t vector_num, uint16_t duration);
+
+bool ISR_PROFILER_Read(uint8_t index, isr_profile_t *profile);
+
+uint16_t ISR_PROFILER_GetMaxLatency(void);
+
+void ISR_PROFILER_Reset(void);
+
+#if defined(__GNUC__)
+
+#undef ISR
+
+/** Handler definition as done by avr-libc */
+#define ISR_PROFILER_SIGNAL(vector, ...)                                                                           \
+	void vector(void) __attribute__((signal, used, externally_visible)) __VA_ARGS__;                                 \
+	void vector(void)
+
+/**
+ * ISR() with profiling. The user body becomes an always-inline function
+ * called between the two timestamps. TCB1.TEMP is preserved because a
+ * level 1 handler may preempt the 16-bit read of a level 0 one.
+ */
+#define ISR(vector, ...)                                                                                           \
+	static inline void vector##_body(void) __attribute__((always_inline));                                           \
+	ISR_PROFILER_SIGNAL(vector, __VA_ARGS__)                                                                         \
+	{                                                                                                                \
+		static isr_profile_t *slot;                                                                                  \
+		uint8_t               temp  = TCB1.TEMP;                                                                     \
+		uint16_t              start = TCB1.CNT;                                                                      \
+		vector##_body();                                                                                             \
+		ISR_PROFILER_Record(&slot, vector##_num, (uint16_t)(TCB1.CNT - start));                                      \
+		TCB1.TEMP = temp;                                                                                            \
+	}                                                                                                                \
+	static inline void vector##_body(void)
+
+/** Handler excluded from profiling, required for ISR_NAKED handlers */
+#define ISR_UNPROFILED(vector, ...) ISR_PROFILER_SIGNAL(vector, __VA_ARGS__)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* ISR_PROFILER_H_INCLUDED */
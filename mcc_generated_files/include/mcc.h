@@ -54,11 +54,20 @@ extern "C" {
 #include "../include/pin_manager.h"
 #include "../include/nvmctrl.h"
 #include "../include/cpuint.h"
+#include "../include/config_store.h"
+#include "../include/event_log.h"
+#include "../include/timebase.h"
+#include "../include/usart1.h"
+#include "../include/power_manager.h"
+#include "../include/scheduler.h"
+#include "../include/watchdog.h"
 /**
  * Initializes MCU, drivers and middleware in the project
 **/
 void SYSTEM_Initialize(void);
 
+int8_t CLKCTRL_Initialize(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -51,6 +51,27 @@ Copyright (c) [2012-2020] Microchip Technology Inc.
 
 #define BOOTLOADER_SECTION __attribute__((section(".bootloader")))
 
+/** Size of the blocks the BOOTSIZE and CODESIZE fuses are counted in */
+#define FLASH_SECTION_BLOCK_SIZE 512UL
+
+/**
+ * Blocks of the BOOT section, written to both BOOTSIZE and CODESIZE.
+ *
+ * The application is linked from address 0 and runs from BOOT. APPCODE is
+ * empty, and the rest of flash is APPDATA, which holds everything rewritten
+ * at run-time. Code in BOOT may program APPDATA. The interrupt vectors are
+ * at the start of BOOT, so CPUINT.CTRLA.IVSEL is set.
+ */
+#ifndef FLASH_BOOT_BLOCKS
+#define FLASH_BOOT_BLOCKS 250
+#endif
+
+/** First address of the APPDATA section */
+#define FLASH_APPDATA_START ((uint32_t)FLASH_BOOT_BLOCKS * FLASH_SECTION_BLOCK_SIZE)
+
+/** Size of the APPDATA section */
+#define FLASH_APPDATA_SIZE ((uint32_t)PROGMEM_SIZE - FLASH_APPDATA_START)
+
 /** Datatype for flash address */
 typedef uint32_t flash_adr_t;
 
@@ -64,10 +85,56 @@ typedef enum {
     NVM_BUSY  = 2, ///< NVMCTRL busy, write ongoing.
 } nvmctrl_status_t;
 
+/** Datatype for the way NVMCTRL routines wait for the controller */
+typedef enum {
+    NVM_WAIT_POLL  = 0, ///< Busy-poll NVMCTRL.STATUS.
+    NVM_WAIT_YIELD = 1, ///< Call the yield function while the controller is busy.
+    NVM_WAIT_SLEEP = 2, ///< Idle sleep until the EEREADY interrupt.
+} nvmctrl_wait_mode_t;
+
+/** Datatype for the function called while waiting in NVM_WAIT_YIELD mode */
+typedef void (*nvmctrl_yield_t)(void);
+
+/** Datatype for the memory a writer context is programming */
+typedef enum {
+    NVM_TARGET_FLASH  = 0, ///< Writer programs flash, erasing pages as they are entered.
+    NVM_TARGET_EEPROM = 1, ///< Writer programs EEPROM with byte erase/write.
+} nvmctrl_target_t;
+
+/** Datatype for the state of a writer context */
+typedef enum {
+    NVM_WRITER_IDLE  = 0, ///< Context is closed, pushes are rejected.
+    NVM_WRITER_OPEN  = 1, ///< Context accepts pushes.
+    NVM_WRITER_ERROR = 2, ///< A push failed or ran past the target range.
+} nvmctrl_writer_state_t;
+
+/**
+ * Writer context for streaming bytes into flash or EEPROM.
+ *
+ * Each context owns its own cursor and page state, so any number of writers
+ * may be open at the same time. A push issues its NVMCTRL command, programs
+ * one byte and clears the command again inside one short critical section,
+ * so the controller is never left holding a command between pushes and
+ * producers in main and in ISRs can interleave freely.
+ */
+typedef struct {
+    nvmctrl_target_t       target; ///< Memory being programmed.
+    nvmctrl_writer_state_t state;  ///< Current state of the context.
+    nvmctrl_status_t       error;  ///< Sticky status of the pushes so far.
+    flash_adr_t            start;  ///< First address of the target range.
+    flash_adr_t            end;    ///< First address past the target range.
+    flash_adr_t            cursor; ///< Address the next pushed byte goes to.
+    flash_adr_t            page;   ///< Start of the flash page last erased by this context.
+} nvmctrl_writer_t;
+
 
 
 int8_t FLASH_Initialize(void);
 
+void FLASH_SetWaitStrategy(nvmctrl_wait_mode_t mode, nvmctrl_yield_t yield);
+
+void FLASH_WaitReady(void);
+
 uint8_t FLASH_ReadEepromByte(eeprom_adr_t eeprom_adr);
 
 nvmctrl_status_t FLASH_WriteEepromByte(eeprom_adr_t eeprom_adr, uint8_t data);
@@ -84,10 +151,20 @@ nvmctrl_status_t FLASH_WriteFlashByte(flash_adr_t flash_adr, uint8_t *ram_buffer
 
 nvmctrl_status_t FLASH_EraseFlashPage(flash_adr_t flash_adr);
 
+nvmctrl_status_t FLASH_StartEraseFlashPage(flash_adr_t flash_adr);
+
 nvmctrl_status_t FLASH_WriteFlashPage(flash_adr_t flash_adr, uint8_t *data);
 
 nvmctrl_status_t FLASH_WriteFlashBlock(flash_adr_t flash_adr, uint8_t *data, size_t size, uint8_t *ram_buffer);
 
 nvmctrl_status_t FLASH_WriteFlashStream(flash_adr_t flash_adr, uint8_t data, bool finalize);
 
+nvmctrl_status_t FLASH_WriterOpen(nvmctrl_writer_t *writer, nvmctrl_target_t target, flash_adr_t start, flash_adr_t size);
+
+nvmctrl_status_t FLASH_WriterPush(nvmctrl_writer_t *writer, uint8_t data);
+
+nvmctrl_status_t FLASH_WriterFlush(nvmctrl_writer_t *writer);
+
+void FLASH_WriterAbort(nvmctrl_writer_t *writer);
+
 #endif /* NVMCTRL_BASIC_H_INCLUDED */
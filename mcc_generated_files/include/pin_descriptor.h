@@ -0,0 +1,169 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef PIN_DESCRIPTOR_H_INCLUDED
+#define PIN_DESCRIPTOR_H_INCLUDED
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../include/utils/compiler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup doc_driver_port_pin_descriptor Pin descriptors
+ * \ingroup doc_driver_port
+ *
+ * A pin descriptor is one byte holding the port index and the bit number,
+ * built with PIN(A, 3) for PA3. When the descriptor is a compile-time
+ * constant the operations below expand to a single instruction on the
+ * VPORT registers; otherwise they fall back to the PORT OUTSET/OUTCLR/OUTTGL
+ * and DIRSET/DIRCLR registers. Both forms modify only the selected bit, so
+ * they never race with ISRs writing other pins of the same port.
+ *
+ * Cycle counts on AVRxt, counted from the generated instruction sequences.
+ * PinDescriptor_Benchmark() in examples/benchmark_example.c measures the
+ * constant and variable forms on the device:
+ *
+ * Operation                    | Constant pin      | Variable pin               | port.h PORTx_*_pin_level
+ * -----------------------------|-------------------|----------------------------|--------------------------
+ * PIN_SET/PIN_CLEAR            | 1 (SBI/CBI)       | ~8 (mask lookup, STS)      | 1 literal, ~12 variable, not atomic
+ * PIN_TOGGLE                   | 1 (SBI on IN)     | ~8 (mask lookup, STS)      | ~12 (RMW on OUTTGL mask)
+ * PIN_READ in a condition      | 1-2 (SBIS/SBIC)   | ~8 (mask lookup, LDS, AND) | 1-2 literal, ~10 variable
+ * PIN_SET_OUTPUT/PIN_SET_INPUT | 1 (SBI/CBI)       | ~8 (mask lookup, STS)      | 1 literal, ~12 variable, not atomic
+ *
+ * The variable form includes computing the port address and bit mask at
+ * run-time, the STS itself takes 2 cycles.
+ *
+ *@{
+ */
+
+#define PIN_PORT_A 0
+#define PIN_PORT_B 1
+#define PIN_PORT_C 2
+#define PIN_PORT_D 3
+#define PIN_PORT_E 4
+#define PIN_PORT_F 5
+#define PIN_PORT_G 6
+
+/** Datatype for a pin descriptor */
+typedef uint8_t pin_t;
+
+/** Descriptor of pin bit of port letter, e.g. PIN(C, 5) */
+#define PIN(letter, bit) ((pin_t)((PIN_PORT_##letter << 3) | (bit)))
+
+/** Descriptor from a port index and a bit number, both possibly variable */
+#define PIN_DESCRIPTOR(port, bit) ((pin_t)(((port) << 3) | ((bit) & 0x07)))
+
+/** Port index of a descriptor, 0 for PORTA */
+#define PIN_PORT_INDEX(pin) ((uint8_t)(pin) >> 3)
+
+/** Bit number of a descriptor */
+#define PIN_BIT(pin) ((uint8_t)(pin) & 0x07)
+
+/** Bit mask of a descriptor */
+#define PIN_MASK(pin) ((uint8_t)(1 << PIN_BIT(pin)))
+
+/** I/O address of the VPORT register at offset reg (0 DIR, 1 OUT, 2 IN) of a pin */
+#define PIN_VPORT_IO_ADDR(pin, reg) (_SFR_IO_ADDR(VPORTA.DIR) + 4 * PIN_PORT_INDEX(pin) + (reg))
+
+/** VPORT registers of a pin, as lvalues */
+#define PIN_VPORT(pin) (*(VPORT_t *)((uint16_t)&VPORTA + 4 * PIN_PORT_INDEX(pin)))
+
+/** PORT registers of a pin, as lvalues */
+#define PIN_PORT(pin) (*(PORT_t *)((uint16_t)&PORTA + (uint16_t)(&PORTB.DIR - &PORTA.DIR) * PIN_PORT_INDEX(pin)))
+
+#if defined(__GNUC__)
+
+#define PIN_ASM_SBI(pin, reg) __asm__ __volatile__("sbi %0, %1" : : "I"(PIN_VPORT_IO_ADDR(pin, reg)), "I"(PIN_BIT(pin)))
+#define PIN_ASM_CBI(pin, reg) __asm__ __volatile__("cbi %0, %1" : : "I"(PIN_VPORT_IO_ADDR(pin, reg)), "I"(PIN_BIT(pin)))
+
+/* Picks the single-instruction form when pin is a compile-time constant.
+ * __builtin_choose_expr discards the other branch, so the "I" constraints
+ * are never seen with a variable pin. */
+#define PIN_OP(pin, constant_form, variable_form)                                                                    \
+	__builtin_choose_expr(__builtin_constant_p(pin), ({ constant_form; }), ({ variable_form; }))
+
+#else
+
+#define PIN_OP(pin, constant_form, variable_form) variable_form
+
+#endif
+
+/** Drive the pin high */
+#define PIN_SET(pin) PIN_OP(pin, PIN_ASM_SBI(pin, 1), PIN_PORT(pin).OUTSET = PIN_MASK(pin))
+
+/** Drive the pin low */
+#define PIN_CLEAR(pin) PIN_OP(pin, PIN_ASM_CBI(pin, 1), PIN_PORT(pin).OUTCLR = PIN_MASK(pin))
+
+/** Invert the pin output, setting a bit of VPORT.IN toggles that bit of OUT */
+#define PIN_TOGGLE(pin) PIN_OP(pin, PIN_ASM_SBI(pin, 2), PIN_PORT(pin).OUTTGL = PIN_MASK(pin))
+
+/** Drive the pin to level */
+#define PIN_WRITE(pin, level)                                                                                        \
+	do {                                                                                                             \
+		if (level) {                                                                                                 \
+			PIN_SET(pin);                                                                                            \
+		} else {                                                                                                     \
+			PIN_CLEAR(pin);                                                                                          \
+		}                                                                                                            \
+	} while (0)
+
+/** Make the pin an output */
+#define PIN_SET_OUTPUT(pin) PIN_OP(pin, PIN_ASM_SBI(pin, 0), PIN_PORT(pin).DIRSET = PIN_MASK(pin))
+
+/** Make the pin an input */
+#define PIN_SET_INPUT(pin) PIN_OP(pin, PIN_ASM_CBI(pin, 0), PIN_PORT(pin).DIRCLR = PIN_MASK(pin))
+
+/** Input level of the pin. With a constant pin and used as a condition this compiles to SBIS/SBIC. */
+#define PIN_READ(pin) ((PIN_VPORT(pin).IN & PIN_MASK(pin)) != 0)
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PIN_DESCRIPTOR_H_INCLUDED */
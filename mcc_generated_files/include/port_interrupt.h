@@ -0,0 +1,171 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef PORT_INTERRUPT_H_INCLUDED
+#define PORT_INTERRUPT_H_INCLUDED
+
+#include "../include/utils/compiler.h"
+#include <avr/pgmspace.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup doc_driver_port_interrupt Port interrupt dispatcher
+ * \ingroup doc_driver_port
+ *
+ * PORTx_PORT_vect handlers for the ports enabled with PORTx_DISPATCH_ENABLE.
+ * A handler reads VPORTx.INTFLAGS once, clears the flags it read with one
+ * store and calls the callback of each set bit, lowest bit first, from a
+ * table in flash defined with PORT_DISPATCH_TABLE(). Pin sensing is
+ * configured with PORTx_pin_set_isc() from port.h.
+ *
+ * For a port with a single interrupt pin, PORT_FAST_ISR() or
+ * PORT_NAKED_ISR() replace the dispatcher for that port.
+ *
+ * Latency from the interrupt request to the first instruction of the
+ * callback or body, counted from the instruction sequences on AVRxt
+ * (response and vector JMP included). PortInterrupt_Benchmark() in
+ * examples/benchmark_example.c measures it on the device, edge detection
+ * included:
+ *
+ * Handler          | Cycles to callback
+ * -----------------|-----------------------------------------------------
+ * Dispatcher       | ~50, +~10 for each lower set bit dispatched before
+ * PORT_FAST_ISR()  | ~10 plus the registers the inlined body needs saved
+ * PORT_NAKED_ISR() | 8
+ *
+ *@{
+ */
+
+/* Ports handled by the dispatcher, 1 to enable */
+#ifndef PORTA_DISPATCH_ENABLE
+#define PORTA_DISPATCH_ENABLE 0
+#endif
+#ifndef PORTB_DISPATCH_ENABLE
+#define PORTB_DISPATCH_ENABLE 0
+#endif
+#ifndef PORTC_DISPATCH_ENABLE
+#define PORTC_DISPATCH_ENABLE 0
+#endif
+#ifndef PORTD_DISPATCH_ENABLE
+#define PORTD_DISPATCH_ENABLE 0
+#endif
+#ifndef PORTE_DISPATCH_ENABLE
+#define PORTE_DISPATCH_ENABLE 0
+#endif
+#ifndef PORTF_DISPATCH_ENABLE
+#define PORTF_DISPATCH_ENABLE 0
+#endif
+#ifndef PORTG_DISPATCH_ENABLE
+#define PORTG_DISPATCH_ENABLE 0
+#endif
+
+/** Datatype for a pin interrupt callback */
+typedef void (*port_interrupt_callback_t)(void);
+
+/**
+ * \brief Define the callback table of a port in flash
+ *
+ * Up to eight callbacks for pins 0 to 7, NULL or missing entries are
+ * skipped. Exactly one table is needed for each enabled port, e.g.
+ * PORT_DISPATCH_TABLE(C, NULL, button_pressed);
+ */
+#define PORT_DISPATCH_TABLE(letter, ...) \
+	const port_interrupt_callback_t port_dispatch_table_##letter[8] PROGMEM = {__VA_ARGS__}
+
+/**
+ * \brief Interrupt handler for one pin of a port, without table or bit scan
+ *
+ * The body is inlined in the handler, so the compiler saves only the
+ * registers it uses. A body calling functions costs the full save of the
+ * call-clobbered registers. This is the fastest form that may contain C;
+ * a naked handler cannot, since the compiler would not save what the body
+ * clobbers.
+ *
+ * \param letter Port letter, the dispatcher of that port must be disabled
+ * \param bit Pin number, its flag is cleared before the body runs
+ * \param body Statements to run, in braces
+ */
+#define PORT_FAST_ISR(letter, bit, body)                                                                           \
+	ISR(PORT##letter##_PORT_vect)                                                                                    \
+	{                                                                                                                \
+		VPORT##letter.INTFLAGS = (1 << (bit));                                                                       \
+		body                                                                                                         \
+	}
+
+/**
+ * \brief Naked interrupt handler for one pin of a port
+ *
+ * Saves only r16, which clears the pin flag, then runs the assembler body
+ * and returns. The body may use r16 and must leave all other registers and
+ * SREG unchanged, which limits it to instructions like SBI, CBI, IN and OUT.
+ *
+ * \param letter Port letter, the dispatcher of that port must be disabled
+ * \param bit Pin number, its flag is cleared before the body runs
+ * \param asm_body Assembler string, e.g. "sbi 0x02, 3" to toggle PA3 through VPORTA.IN
+ */
+#define PORT_NAKED_ISR(letter, bit, asm_body)                                                                      \
+	ISR_UNPROFILED(PORT##letter##_PORT_vect, ISR_NAKED)                                                                         \
+	{                                                                                                                \
+		__asm__ __volatile__("push r16"                                                                              \
+		                     "\n\t"                                                                                  \
+		                     "ldi r16, %[mask]"                                                                      \
+		                     "\n\t"                                                                                  \
+		                     "out %[flags], r16"                                                                     \
+		                     "\n\t" asm_body "\n\t"                                                                  \
+		                     "pop r16"                                                                               \
+		                     "\n\t"                                                                                  \
+		                     "reti"                                                                                  \
+		                     :                                                                                       \
+		                     : [mask] "M"(1 << (bit)), [flags] "I"(_SFR_IO_ADDR(VPORT##letter.INTFLAGS)));          \
+	}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORT_INTERRUPT_H_INCLUDED */
@@ -0,0 +1,156 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef POWER_MANAGER_H_INCLUDED
+#define POWER_MANAGER_H_INCLUDED
+
+#include "../include/utils/compiler.h"
+#include "../include/timebase.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup doc_driver_power_manager Power manager
+ *
+ * Picks the deepest sleep mode the running peripherals allow each time the
+ * main loop goes idle. A driver needing a clock that a sleep mode stops
+ * takes a lock on that mode while it is busy, e.g. USART1 locks
+ * POWER_MODE_STANDBY while it transmits, and for as long as its receiver
+ * is enabled, since the receiver needs CLK_PER to catch a start bit. A
+ * lock on a mode also forbids all deeper modes; a lock on POWER_MODE_IDLE
+ * keeps the CPU awake.
+ *
+ * A mode is also skipped when its wake-up time exceeds the latency limit
+ * or the time left until the caller's next deadline. The wake-up time of
+ * a mode is the delay sleeping adds to the interrupt response: the
+ * POWER_WAKEUP_CYCLES the data sheet gives for any wake-up, plus the
+ * start-up time of what the mode switches off. Idle stops only the CPU
+ * clock. In standby TCA0 keeps the high-frequency oscillator running, and
+ * the regulator returns to full performance. Power-down also stops the
+ * oscillator, and the CPU is halted until it is stable again, so nothing
+ * has to be restored in software. The defaults assume the internal
+ * high-frequency oscillator; take them from the data sheet start-up times
+ * when running from another source.
+ *
+ * PowerWake_Benchmark() in examples/benchmark_example.c measures the idle
+ * and standby wake-up and checks them against these figures. Power-down
+ * stops TCA0, so it cannot be timed that way.
+ *
+ * TCA0 keeps counting in standby (see TIMEBASE_Initialize()), so the
+ * timebase and the scheduler wake-up work there. In power-down the
+ * timebase stands still: only pin, PIT and TWI address interrupts wake the
+ * device, and time spent in power-down is not in the tick statistics.
+ *
+ *@{
+ */
+
+/** Cycles a wake-up from any sleep mode adds to the interrupt response */
+#ifndef POWER_WAKEUP_CYCLES
+#define POWER_WAKEUP_CYCLES 5
+#endif
+
+/** Start-up time after idle in microseconds, no clock is stopped */
+#ifndef POWER_WAKEUP_US_IDLE
+#define POWER_WAKEUP_US_IDLE 0
+#endif
+
+/** Start-up time after standby in microseconds, the regulator leaving low-power mode */
+#ifndef POWER_WAKEUP_US_STANDBY
+#define POWER_WAKEUP_US_STANDBY 10
+#endif
+
+/** Start-up time after power-down in microseconds, oscillator and regulator */
+#ifndef POWER_WAKEUP_US_POWER_DOWN
+#define POWER_WAKEUP_US_POWER_DOWN 30
+#endif
+
+/** Largest number of registered hooks */
+#ifndef POWER_HOOK_MAX
+#define POWER_HOOK_MAX 4
+#endif
+
+/** Sleep modes, from shallow to deep */
+typedef enum {
+    POWER_MODE_ACTIVE     = 0, ///< No sleep, the CPU stayed awake
+    POWER_MODE_IDLE       = 1, ///< CPU stopped, all peripherals run
+    POWER_MODE_STANDBY    = 2, ///< Only RUNSTDBY peripherals run
+    POWER_MODE_POWER_DOWN = 3, ///< Only asynchronous wake-up sources
+    POWER_MODE_COUNT      = 4,
+} power_mode_t;
+
+/** Datatype for a hook, called with wake false before sleeping and true after waking */
+typedef void (*power_hook_t)(power_mode_t mode, bool wake);
+
+/** Statistics of one mode */
+typedef struct {
+    uint32_t entries; ///< Times the mode was entered, for ACTIVE the times sleep was refused
+    uint32_t ticks;   ///< Timebase ticks spent in the mode, wraps
+} power_stats_t;
+
+void POWER_Initialize(void);
+
+void POWER_Lock(power_mode_t mode);
+
+void POWER_Unlock(power_mode_t mode);
+
+power_mode_t POWER_GetAllowedMode(void);
+
+void POWER_SetLatencyLimit(uint32_t us);
+
+int8_t POWER_RegisterHook(power_hook_t hook);
+
+power_mode_t POWER_Sleep(timebase_t budget);
+
+bool POWER_GetStats(power_mode_t mode, power_stats_t *stats);
+
+void POWER_ResetStats(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POWER_MANAGER_H_INCLUDED */
@@ -0,0 +1,118 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef SCHEDULER_H_INCLUDED
+#define SCHEDULER_H_INCLUDED
+
+#include "../include/utils/compiler.h"
+#include "../include/timebase.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup doc_driver_scheduler Cooperative scheduler
+ *
+ * Runs periodic tasks from the main loop. Tasks run to completion and are
+ * never preempted by one another, so they share data without locking.
+ * Each task is released every period; its deadline is its next release.
+ * When several tasks are due, the one with the earliest deadline runs
+ * first, one task per SCHEDULER_RunOnce() call.
+ *
+ * With nothing due, the CPU sleeps until the next release: TCA0 CMP0 is
+ * set to the release time and the power manager picks the deepest mode
+ * that wakes up in time. Releases more than 65536 ticks away are reached
+ * through the timebase overflow interrupt, which wakes the core as well.
+ * There is no periodic tick. Adding the first task locks power-down,
+ * where TCA0 stops.
+ *
+ * Times are timebase ticks, CLK_PER cycles. Periods given in microseconds
+ * are converted once when the task is added, add tasks after changing the
+ * clock.
+ *
+ *@{
+ */
+
+/** Largest number of tasks */
+#ifndef SCHEDULER_TASK_MAX
+#define SCHEDULER_TASK_MAX 8
+#endif
+
+/** Releases closer than this are waited for awake, a shorter sleep could miss the compare */
+#ifndef SCHEDULER_SLEEP_MARGIN
+#define SCHEDULER_SLEEP_MARGIN 64
+#endif
+
+/** Datatype for a task function */
+typedef void (*scheduler_task_t)(void);
+
+/** Execution statistics of one task, in ticks */
+typedef struct {
+    uint32_t runs;     ///< Completed runs
+    uint32_t total;    ///< Sum of all execution times, wraps
+    uint32_t max;      ///< Longest execution time
+    uint32_t last;     ///< Execution time of the last run
+    uint16_t overruns; ///< Runs that finished after their deadline
+    uint16_t skipped;  ///< Releases dropped because the task was still late
+} scheduler_stats_t;
+
+int8_t SCHEDULER_AddTask(scheduler_task_t task, timebase_t period, timebase_t offset);
+
+int8_t SCHEDULER_AddTaskUs(scheduler_task_t task, uint32_t period_us);
+
+void SCHEDULER_RunOnce(void);
+
+void SCHEDULER_Run(void);
+
+bool SCHEDULER_GetStats(int8_t id, scheduler_stats_t *stats);
+
+void SCHEDULER_ResetStats(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDULER_H_INCLUDED */
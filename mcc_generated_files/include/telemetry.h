@@ -0,0 +1,85 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef TELEMETRY_H_INCLUDED
+#define TELEMETRY_H_INCLUDED
+
+#include "../include/utils/compiler.h"
+#include "../include/telemetry_protocol.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup doc_driver_telemetry Telemetry
+ *
+ * Binary records over USART1, framed as described in telemetry_protocol.h
+ * and decoded on the host by tools/telemetry_decode.c. A frame is queued
+ * whole or not at all: with USART1_POLICY_DROP a frame that does not fit
+ * in the transmit buffer is counted and skipped, and its sequence number
+ * is still used up, so the host sees the gap. Text from FMT_ or printf
+ * may share the line, the decoder resynchronizes on the next delimiter.
+ *
+ * Send from main only, the sequence number is not protected.
+ *
+ *@{
+ */
+
+bool TELEMETRY_Send(uint8_t type, const uint8_t *body, uint8_t size);
+
+bool TELEMETRY_SendDiag(uint8_t test, uint8_t status, int32_t value);
+
+bool TELEMETRY_SendBootTime(uint8_t stage, uint32_t ticks);
+
+bool TELEMETRY_SendCounter(uint8_t counter, uint32_t value);
+
+uint16_t TELEMETRY_GetDropCount(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TELEMETRY_H_INCLUDED */
@@ -0,0 +1,185 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef TELEMETRY_PROTOCOL_H_INCLUDED
+#define TELEMETRY_PROTOCOL_H_INCLUDED
+
+#include "crc.h"
+#include "cobs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup doc_driver_telemetry_protocol Telemetry frame format
+ *
+ * Shared by the firmware and tools/telemetry_decode.c, so it uses plain C
+ * only. All multi-byte fields are little-endian.
+ *
+ * Frame on the wire: one 0x00 byte, COBS(payload), one 0x00 byte. The
+ * leading delimiter ends any text sent before the frame, which contains no
+ * zero byte of its own, so the text is dropped as one bad frame instead of
+ * merging with the frame. Two delimiters in a row make an empty frame,
+ * which the decoder ignores.
+ *
+ * Payload:
+ * Offset | Size | Field
+ * -------|------|-----------------------------------------------------
+ * 0      | 1    | Record type, telemetry_type_t
+ * 1      | 2    | Sequence number, +1 per frame including dropped ones
+ * 3      | 4    | Timestamp, TIMEBASE_Now() ticks
+ * 7      | n    | Record body, layout per type below
+ * 7 + n  | 2    | CRC-16/CCITT of all previous payload bytes
+ *
+ * Bodies:
+ * - TELEMETRY_DIAG: test (telemetry_test_t), status (the module's status
+ *   enum value), int32 value (e.g. clock deviation in ppm)
+ * - TELEMETRY_BOOT_TIME: stage, uint32 ticks, uint32 clock frequency in Hz
+ * - TELEMETRY_COUNTER: counter id (telemetry_counter_t), uint32 value
+ *
+ *@{
+ */
+
+/** Bytes before the record body */
+#define TELEMETRY_HEADER_SIZE 7
+
+/** Bytes after the record body */
+#define TELEMETRY_CRC_SIZE 2
+
+/** Largest record body */
+#define TELEMETRY_BODY_MAX 16
+
+/** Largest frame on the wire, delimiters included */
+#define TELEMETRY_FRAME_MAX (COBS_ENCODED_MAX(TELEMETRY_HEADER_SIZE + TELEMETRY_BODY_MAX + TELEMETRY_CRC_SIZE) + 2)
+
+/** Record types */
+typedef enum {
+    TELEMETRY_DIAG      = 1, ///< Result of a diagnostic test
+    TELEMETRY_BOOT_TIME = 2, ///< Time at which a boot stage completed
+    TELEMETRY_COUNTER   = 3, ///< Value of a counter
+} telemetry_type_t;
+
+/** Tests reported in TELEMETRY_DIAG records */
+typedef enum {
+    TELEMETRY_TEST_SRAM_MARCHB       = 1,
+    TELEMETRY_TEST_SRAM_CHECKERBOARD = 2,
+    TELEMETRY_TEST_FLASH_CRC         = 3,
+    TELEMETRY_TEST_CLOCK             = 4,
+} telemetry_test_t;
+
+/** Counters reported in TELEMETRY_COUNTER records */
+typedef enum {
+    TELEMETRY_COUNTER_TX_DROPPED     = 1, ///< USART1 bytes dropped
+    TELEMETRY_COUNTER_RX_DROPPED     = 2, ///< USART1 bytes lost on receive
+    TELEMETRY_COUNTER_FRAMES_DROPPED = 3, ///< Telemetry frames not sent
+    TELEMETRY_COUNTER_EVENT_LOG      = 4, ///< Event log sequence number
+} telemetry_counter_t;
+
+/** Store a 16-bit field */
+static inline void TELEMETRY_Put16(uint8_t *at, uint16_t value)
+{
+    at[0] = (uint8_t)value;
+    at[1] = (uint8_t)(value >> 8);
+}
+
+/** Store a 32-bit field */
+static inline void TELEMETRY_Put32(uint8_t *at, uint32_t value)
+{
+    TELEMETRY_Put16(at, (uint16_t)value);
+    TELEMETRY_Put16(at + 2, (uint16_t)(value >> 16));
+}
+
+/** Load a 16-bit field */
+static inline uint16_t TELEMETRY_Get16(const uint8_t *at)
+{
+    return (uint16_t)(at[0] | ((uint16_t)at[1] << 8));
+}
+
+/** Load a 32-bit field */
+static inline uint32_t TELEMETRY_Get32(const uint8_t *at)
+{
+    return TELEMETRY_Get16(at) | ((uint32_t)TELEMETRY_Get16(at + 2) << 16);
+}
+
+/**
+ * \brief Build a complete frame
+ *
+ * \param[out] frame TELEMETRY_FRAME_MAX bytes of room
+ * \param[in] type Record type
+ * \param[in] sequence Sequence number
+ * \param[in] timestamp Timestamp
+ * \param[in] body Record body
+ * \param[in] size Size of the body, up to TELEMETRY_BODY_MAX
+ *
+ * \return Frame length, delimiters included
+ */
+static inline size_t TELEMETRY_BuildFrame(uint8_t *frame, uint8_t type, uint16_t sequence, uint32_t timestamp,
+                                          const uint8_t *body, uint8_t size)
+{
+    uint8_t  payload[TELEMETRY_HEADER_SIZE + TELEMETRY_BODY_MAX + TELEMETRY_CRC_SIZE];
+    uint8_t  length = TELEMETRY_HEADER_SIZE + size;
+    size_t   out;
+
+    payload[0] = type;
+    TELEMETRY_Put16(&payload[1], sequence);
+    TELEMETRY_Put32(&payload[3], timestamp);
+    for (uint8_t i = 0; i < size; i++) {
+        payload[TELEMETRY_HEADER_SIZE + i] = body[i];
+    }
+    TELEMETRY_Put16(&payload[length], CRC16_Update(CRC16_INITIAL, payload, length));
+
+    frame[0]   = 0;
+    out        = 1 + COBS_Encode(payload, length + TELEMETRY_CRC_SIZE, &frame[1]);
+    frame[out] = 0;
+
+    return out + 1;
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TELEMETRY_PROTOCOL_H_INCLUDED */
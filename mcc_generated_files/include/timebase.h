@@ -0,0 +1,109 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef TIMEBASE_H_INCLUDED
+#define TIMEBASE_H_INCLUDED
+
+#include "../include/utils/compiler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup doc_driver_timebase Timebase
+ *
+ * Free-running TCA0 counting CLK_PER undivided, extended in software by an
+ * overflow counter. Timestamps are monotonic ticks of CLK_PER; the tick
+ * rate follows the clock manager, so durations spanning a frequency change
+ * should not be converted with the conversion helpers.
+ *
+ * TCA0 runs in standby as well, keeping the oscillator on there, so time
+ * does not stop while the power manager sleeps. It stops in power-down.
+ *
+ * Readers never disable interrupts. They read a one-byte generation
+ * counter, the overflow count and TCA0.CNT, and retry if the overflow ISR
+ * ran in between. When the caller has interrupts disabled the ISR cannot
+ * run, so a pending overflow flag is accounted for instead.
+ *
+ * TCA0.CNT is read through the shared TEMP register. Any ISR reading or
+ * writing 16-bit registers of TCA0 must save and restore
+ * TCA0.SINGLE.TEMP, see TIMEBASE_TEMP_SAVE().
+ *
+ * Reading from a level 1 ISR that preempts the overflow ISR can be off by
+ * one overflow, keep TCA0_OVF_vect at the highest level in use.
+ *
+ * The interrupt costs about 30 cycles every 65536 CLK_PER cycles.
+ *
+ *@{
+ */
+
+/** Datatype for a 32-bit timestamp, wraps after 2^32 CLK_PER cycles */
+typedef uint32_t timebase_t;
+
+/** Save TCA0.SINGLE.TEMP at the start of an ISR touching 16-bit TCA0 registers */
+#define TIMEBASE_TEMP_SAVE() uint8_t timebase_temp = TCA0.SINGLE.TEMP
+
+/** Restore TCA0.SINGLE.TEMP at the end of that ISR */
+#define TIMEBASE_TEMP_RESTORE() (TCA0.SINGLE.TEMP = timebase_temp)
+
+/** Elapsed ticks between two 32-bit timestamps, valid across a wrap */
+#define TIMEBASE_ELAPSED(since, now) ((timebase_t)((now) - (since)))
+
+void TIMEBASE_Initialize(void);
+
+timebase_t TIMEBASE_Now(void);
+
+uint64_t TIMEBASE_Now64(void);
+
+uint32_t TIMEBASE_TicksToUs(timebase_t ticks);
+
+timebase_t TIMEBASE_UsToTicks(uint32_t us);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMEBASE_H_INCLUDED */
@@ -0,0 +1,129 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef USART1_BASIC_H_INCLUDED
+#define USART1_BASIC_H_INCLUDED
+
+#include "../include/utils/compiler.h"
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup doc_driver_usart1 USART1 driver
+ *
+ * Interrupt-driven USART1 on PC0 (TXD) and PC1 (RXD), the virtual COM port
+ * of the Curiosity Nano. USART1_Write() only queues the byte; the DRE
+ * interrupt moves it to the wire. Received bytes are queued by the RXC
+ * interrupt. The baud register is recomputed from clock_frequency by a
+ * clock manager consumer, so USART1_BAUD_RATE holds across clock changes.
+ * The receiver needs CLK_PER to sample the line, which standby stops, so
+ * USART1_Initialize() locks standby in the power manager for as long as
+ * the receiver is enabled. The transmitter also holds its own standby
+ * lock while bytes are queued or shifting out.
+ *
+ * USART1_Initialize() binds stdout to USART1_stream. printf() then costs
+ * the formatting time plus a few cycles per byte, never the wire time,
+ * as long as the output fits in the transmit buffer.
+ *
+ *@{
+ */
+
+/** Baud rate in bit/s */
+#ifndef USART1_BAUD_RATE
+#define USART1_BAUD_RATE 115200UL
+#endif
+
+/** Transmit buffer size, a power of two up to 128 */
+#ifndef USART1_TX_BUFFER_SIZE
+#define USART1_TX_BUFFER_SIZE 64
+#endif
+
+/** Receive buffer size, a power of two up to 128 */
+#ifndef USART1_RX_BUFFER_SIZE
+#define USART1_RX_BUFFER_SIZE 16
+#endif
+
+/** Full transmit buffer: the byte is dropped and counted */
+#define USART1_POLICY_DROP 0
+
+/** Full transmit buffer: wait for room, unless interrupts are disabled */
+#define USART1_POLICY_BLOCK 1
+
+/** What USART1_Write() does with a full transmit buffer */
+#ifndef USART1_TX_POLICY
+#define USART1_TX_POLICY USART1_POLICY_DROP
+#endif
+
+/** stdio stream writing to USART1, stdout after USART1_Initialize() */
+extern FILE USART1_stream;
+
+int8_t USART1_Initialize(void);
+
+bool USART1_IsTxReady(void);
+
+uint8_t USART1_GetTxFree(void);
+
+bool USART1_IsTxDone(void);
+
+bool USART1_Write(uint8_t data);
+
+uint8_t USART1_WriteBuffer(const uint8_t *data, uint8_t size);
+
+bool USART1_IsRxReady(void);
+
+bool USART1_Read(uint8_t *data);
+
+uint16_t USART1_GetTxDropCount(void);
+
+uint16_t USART1_GetRxDropCount(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* USART1_BASIC_H_INCLUDED */
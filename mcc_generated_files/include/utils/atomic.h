@@ -56,53 +56,105 @@ Copyright (c) [2012-2020] Microchip Technology Inc.
 
 /* clang-format off */
 
+#include <stdint.h>
+
 #if defined(__GNUC__) || defined (__DOXYGEN__)
 
+/**
+ * \brief Save SREG and clear the Global Interrupt Enable bit
+ *
+ * \return The status register as it was before
+ */
+static inline uint8_t CRITICAL_Enter(void) __attribute__((always_inline));
+static inline uint8_t CRITICAL_Enter(void)
+{
+   uint8_t sreg;
+
+   __asm__ __volatile__ (
+      "in %0, __SREG__"                          "\n\t"
+      "cli"                                      "\n\t"
+      : "=r" (sreg) :: "memory"
+      );
+   return sreg;
+}
+
+/**
+ * \brief Restore SREG saved by CRITICAL_Enter()
+ *
+ * Takes a pointer so that it can be used as a cleanup function.
+ *
+ * \param[in] sreg The saved status register
+ */
+static inline void CRITICAL_Exit(const uint8_t *sreg) __attribute__((always_inline));
+static inline void CRITICAL_Exit(const uint8_t *sreg)
+{
+   __asm__ __volatile__ (
+      "out __SREG__, %0"                         "\n\t"
+      :: "r" (*sreg) : "memory"
+      );
+}
+
 /**
  * \brief Enter a critical region
  * 
  * Saves the contents of the status register, including the Global 
  * Interrupt Enable bit, so that it can be restored upon leaving the 
  * critical region. Thereafter, clears the Global Interrupt Enable Bit.
- * This macro takes a parameter P that is unused for the GCC compiler,
- * but necessary for code compatibility with the IAR compiler. The IAR
- * compiler declares a variable with the name of the parameter for
- * holding the SREG value. Since a variable is declared in the macro,
- * this variable must have a name that is unique within the scope
- * that the critical region is declared within, otherwise compilation 
- * will fail.
+ * The status register is held in a variable named by the parameter, as
+ * with the IAR compiler, so it stays in a register instead of going
+ * through the stack. Since a variable is declared in the macro, this
+ * variable must have a name that is unique within the scope that the
+ * critical region is declared within, otherwise compilation will fail.
+ *
+ * Entering and leaving takes in, cli and out, 3 cycles, where pushing
+ * SREG through the stack took 6 cycles and a stack byte, 3 of those
+ * cycles with interrupts off.
  *
- * \param[in] UNUSED(GCC)/P(IAR) Name of variable storing SREG
+ * \param[in] P Name of variable storing SREG
  *
  */
 
-#define ENTER_CRITICAL(UNUSED) __asm__ __volatile__ (   \
-   "in __tmp_reg__, __SREG__"                    "\n\t" \
-   "cli"                                         "\n\t" \
-   "push __tmp_reg__"                            "\n\t" \
-   ::: "memory"                                         \
-   )
+#define ENTER_CRITICAL(P)  uint8_t P = CRITICAL_Enter()
 
 /**
  * \brief Exit a critical region
  * 
  * Restores the contents of the status register, including the Global 
  * Interrupt Enable bit, as it was when entering the critical region.
- * This macro takes a parameter P that is unused for the GCC compiler,
- * but necessary for code compatibility with the IAR compiler. The IAR
- * compiler uses this parameter as the name of a variable that holds 
- * the SREG value. The parameter must be identical to the parameter 
- * used in the corresponding ENTER_CRITICAL().
+ * The parameter must be identical to the parameter used in the
+ * corresponding ENTER_CRITICAL().
  *
- * \param[in] UNUSED(GCC)/P(IAR) Name of variable storing SREG
+ * \param[in] P Name of variable storing SREG
+ *
+ */
+
+#define EXIT_CRITICAL(P)  CRITICAL_Exit(&(P))
+
+#define CRITICAL_CAT_(a, b) a##b
+#define CRITICAL_CAT(a, b) CRITICAL_CAT_(a, b)
+
+/**
+ * \brief Critical region lasting to the end of the enclosing block
+ *
+ * SREG is restored by a cleanup function when the block is left, on
+ * return and break included, so early exits cannot leave interrupts off.
+ * GCC only.
+ */
+
+#define CRITICAL_SCOPE()                                                \
+   uint8_t CRITICAL_CAT(critical_scope_, __LINE__)                      \
+      __attribute__((cleanup(CRITICAL_Exit), unused)) = CRITICAL_Enter()
+
+/**
+ * \brief Critical region around the statement or block that follows
  *
+ * CRITICAL_SECTION() { ... } runs the block once with interrupts off and
+ * restores SREG however the block is left. GCC only.
  */
 
-#define EXIT_CRITICAL(UNUSED)  __asm__ __volatile__ (   \
-   "pop __tmp_reg__"                             "\n\t" \
-   "out __SREG__, __tmp_reg__"                   "\n\t" \
-   ::: "memory"                                         \
-   )
+#define CRITICAL_SECTION()                                              \
+   for (uint8_t critical_sreg __attribute__((cleanup(CRITICAL_Exit))) = CRITICAL_Enter(), \
+        critical_once = 1; critical_once; critical_once = 0)
 
 #define DISABLE_INTERRUPTS()        __asm__ __volatile__ ( "cli" ::: "memory")
 #define ENABLE_INTERRUPTS()         __asm__ __volatile__ ( "sei" ::: "memory")
@@ -119,6 +171,67 @@ Copyright (c) [2012-2020] Microchip Technology Inc.
 #  error Unsupported compiler.
 #endif
 
+/**
+ * \brief Mask peripheral interrupts
+ *
+ * Clears the mask bits in a peripheral interrupt control register and
+ * returns which of them were set. Global interrupts are off only for the
+ * read-modify-write of the register, so a handler clearing or setting its
+ * own enable bits cannot be overwritten.
+ *
+ * \param[in] intctrl Interrupt control register
+ * \param[in] mask Interrupt enable bits to clear
+ *
+ * \return The mask bits that were set
+ */
+static inline uint8_t CRITICAL_MaskEnter(volatile uint8_t *intctrl, uint8_t mask)
+{
+   uint8_t enabled;
+
+   ENTER_CRITICAL(M);
+   enabled  = *intctrl;
+   *intctrl = enabled & ~mask;
+   EXIT_CRITICAL(M);
+   return enabled & mask;
+}
+
+/**
+ * \brief Unmask peripheral interrupts masked by CRITICAL_MaskEnter()
+ *
+ * \param[in] intctrl Interrupt control register
+ * \param[in] enabled The value returned by CRITICAL_MaskEnter()
+ */
+static inline void CRITICAL_MaskExit(volatile uint8_t *intctrl, uint8_t enabled)
+{
+   ENTER_CRITICAL(M);
+   *intctrl |= enabled;
+   EXIT_CRITICAL(M);
+}
+
+/**
+ * \brief Enter a region where only the given peripheral interrupts are off
+ *
+ * Other interrupts keep running, so the region adds no latency to them.
+ * Interrupt flags raised meanwhile stay pending and their handlers run
+ * on EXIT_CRITICAL_MASK(). Enable bits that were clear on entry are not
+ * set on exit, the region may set them itself.
+ *
+ * \param[in] P Name of variable storing the masked enable bits
+ * \param[in] INTCTRL Interrupt control register, e.g. USART1.CTRLA
+ * \param[in] MASK Interrupt enable bits to clear
+ */
+
+#define ENTER_CRITICAL_MASK(P, INTCTRL, MASK)  uint8_t P = CRITICAL_MaskEnter(&(INTCTRL), (MASK))
+
+/**
+ * \brief Exit a region entered with ENTER_CRITICAL_MASK()
+ *
+ * \param[in] P Name used in the corresponding ENTER_CRITICAL_MASK()
+ * \param[in] INTCTRL Interrupt control register
+ */
+
+#define EXIT_CRITICAL_MASK(P, INTCTRL)  CRITICAL_MaskExit(&(INTCTRL), (P))
+
 /* clang-format on */
 
 #endif /* ATOMIC_H */
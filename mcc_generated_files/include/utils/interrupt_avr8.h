@@ -60,6 +60,10 @@ Copyright (c) [2012-2020] Microchip Technology Inc.
  * @{
  */
 
+#if defined(ISR_PROFILER_ENABLE) && ISR_PROFILER_ENABLE && !defined(ISR_CUSTOM_H)
+#define ISR_CUSTOM_H "../isr_profiler.h"
+#endif
+
 #ifdef ISR_CUSTOM_H
 #include ISR_CUSTOM_H
 #else
@@ -88,6 +92,14 @@ Copyright (c) [2012-2020] Microchip Technology Inc.
 #endif
 #endif // ISR_CUSTOM_H
 
+/**
+ * \def ISR_UNPROFILED
+ * \brief ISR() that is never instrumented, see isr_profiler.h
+ */
+#ifndef ISR_UNPROFILED
+#define ISR_UNPROFILED ISR
+#endif
+
 #ifdef __GNUC__
 #define cpu_irq_enable() sei()
 #define cpu_irq_disable() cli()
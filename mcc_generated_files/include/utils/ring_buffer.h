@@ -0,0 +1,193 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+/**
+ * \defgroup doc_driver_utils_ring_buffer Single-producer/single-consumer ring buffers
+ * \ingroup doc_driver_utils
+ *
+ * Lock-free ring buffers for passing data from one ISR to main, or from
+ * main to one ISR, without disabling interrupts.
+ *
+ * RING_BUFFER_DECLARE(name, type, size) declares the type name_t and its
+ * static inline functions name_Push(), name_Pop(), name_PushBulk(),
+ * name_PopBulk(), name_Count(), name_Free() and name_Flush(). The
+ * producer only writes head and the consumer only writes tail. Both
+ * indices are 8-bit and free-running, so loading one is a single
+ * instruction and never tears. head - tail is the fill level, which
+ * limits size to a power of two of at most 128.
+ *
+ * The element is always stored before head is published, and read
+ * before tail is published. RING_BUFFER_BARRIER() keeps the compiler
+ * from reordering the non-volatile data access past the index store. The
+ * core does not reorder memory accesses, so no other fence is needed.
+ *
+ * \code
+ * RING_BUFFER_DECLARE(adc_ring, uint16_t, 32)
+ * static adc_ring_t adc_samples;
+ *
+ * ISR(ADC0_RESRDY_vect) { adc_ring_Push(&adc_samples, ADC0.RES); }
+ * ...
+ * uint16_t sample;
+ * while (adc_ring_Pop(&adc_samples, &sample)) { ... }
+ * \endcode
+ *
+ * \{
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "utils_assert.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* clang-format off */
+
+#if defined(__GNUC__) || defined (__DOXYGEN__)
+#define RING_BUFFER_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+#elif defined(__ICCAVR__)
+#define RING_BUFFER_BARRIER() __no_operation()
+#else
+#  error Unsupported compiler.
+#endif
+
+/**
+ * \brief Declare a ring buffer type and its access functions
+ *
+ * \param[in] name Prefix of the type and the functions
+ * \param[in] type Element type
+ * \param[in] size Number of elements, a power of two from 2 to 128
+ */
+#define RING_BUFFER_DECLARE(name, type, size)                                   \
+                                                                                \
+STATIC_ASSERT((size) >= 2 && (size) <= 128                                      \
+              && ((size) & ((size) - 1)) == 0, name##_size_invalid);           \
+                                                                                \
+typedef struct {                                                                \
+    volatile uint8_t head;                                                      \
+    volatile uint8_t tail;                                                      \
+    type             data[size];                                                \
+} name##_t;                                                                     \
+                                                                                \
+static inline uint8_t name##_Count(const name##_t *rb)                         \
+{                                                                               \
+    return (uint8_t)(rb->head - rb->tail);                                      \
+}                                                                               \
+                                                                                \
+static inline uint8_t name##_Free(const name##_t *rb)                          \
+{                                                                               \
+    return (uint8_t)((size) - (uint8_t)(rb->head - rb->tail));                  \
+}                                                                               \
+                                                                                \
+static inline bool name##_Push(name##_t *rb, type value)                        \
+{                                                                               \
+    uint8_t head = rb->head;                                                    \
+                                                                                \
+    if ((uint8_t)(head - rb->tail) >= (size))                                   \
+        return false;                                                           \
+    rb->data[head & ((size) - 1)] = value;                                      \
+    RING_BUFFER_BARRIER();                                                      \
+    rb->head = head + 1;                                                        \
+    return true;                                                                \
+}                                                                               \
+                                                                                \
+static inline bool name##_Pop(name##_t *rb, type *value)                        \
+{                                                                               \
+    uint8_t tail = rb->tail;                                                    \
+                                                                                \
+    if (rb->head == tail)                                                       \
+        return false;                                                           \
+    *value = rb->data[tail & ((size) - 1)];                                     \
+    RING_BUFFER_BARRIER();                                                      \
+    rb->tail = tail + 1;                                                        \
+    return true;                                                                \
+}                                                                               \
+                                                                                \
+static inline uint8_t name##_PushBulk(name##_t *rb, const type *src,            \
+                                      uint8_t count)                            \
+{                                                                               \
+    uint8_t head = rb->head;                                                    \
+    uint8_t room = (uint8_t)((size) - (uint8_t)(head - rb->tail));              \
+                                                                                \
+    if (count > room)                                                           \
+        count = room;                                                           \
+    for (uint8_t i = 0; i < count; i++)                                         \
+        rb->data[(uint8_t)(head + i) & ((size) - 1)] = src[i];                  \
+    RING_BUFFER_BARRIER();                                                      \
+    rb->head = head + count;                                                    \
+    return count;                                                               \
+}                                                                               \
+                                                                                \
+static inline uint8_t name##_PopBulk(name##_t *rb, type *dst, uint8_t count)   \
+{                                                                               \
+    uint8_t tail  = rb->tail;                                                   \
+    uint8_t avail = (uint8_t)(rb->head - tail);                                 \
+                                                                                \
+    if (count > avail)                                                          \
+        count = avail;                                                          \
+    for (uint8_t i = 0; i < count; i++)                                         \
+        dst[i] = rb->data[(uint8_t)(tail + i) & ((size) - 1)];                  \
+    RING_BUFFER_BARRIER();                                                      \
+    rb->tail = tail + count;                                                    \
+    return count;                                                               \
+}                                                                               \
+                                                                                \
+static inline void name##_Flush(name##_t *rb)                                   \
+{                                                                               \
+    rb->tail = rb->head;                                                        \
+}
+
+/* clang-format on */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} */
+
+#endif /* RING_BUFFER_H */
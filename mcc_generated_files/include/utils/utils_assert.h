@@ -57,6 +57,7 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /**
  * \brief Assert macro
@@ -77,6 +78,95 @@ extern "C" {
 #define ASSERT(condition) ((void)0)
 #endif
 
+#define STATIC_ASSERT_CAT_(a, b) a##b
+#define STATIC_ASSERT_CAT(a, b) STATIC_ASSERT_CAT_(a, b)
+
+/**
+ * \brief Compile-time assert
+ *
+ * Fails the build with a negative array size when the constant condition
+ * is false. The message is an identifier that shows up in the error, e.g.
+ * STATIC_ASSERT(SIZE <= 64, buffer_too_large). Costs no code or data, and
+ * can be used at file scope and in functions.
+ *
+ * \param[in] condition Integer constant expression that must be true
+ * \param[in] message Identifier describing the failure
+ */
+#define STATIC_ASSERT(condition, message)                                                                              \
+	typedef char STATIC_ASSERT_CAT(static_assert_##message##_, __LINE__)[(condition) ? 1 : -1]                        \
+	    __attribute__((unused))
+
+/** \brief Compile-time assert that value is a power of two */
+#define STATIC_ASSERT_POWER_OF_TWO(value, message)                                                                     \
+	STATIC_ASSERT(((value) > 0) && (((value) & ((value)-1)) == 0), message)
+
+/** \brief Compile-time assert that value is a multiple of alignment, a power of two */
+#define STATIC_ASSERT_ALIGNED(value, alignment, message) STATIC_ASSERT(((value) & ((alignment)-1)) == 0, message)
+
+/** \brief Compile-time assert that two address ranges do not overlap */
+#define STATIC_ASSERT_NO_OVERLAP(start_a, size_a, start_b, size_b, message)                                            \
+	STATIC_ASSERT(((start_a) + (size_a) <= (start_b)) || ((start_b) + (size_b) <= (start_a)), message)
+
+/** \brief Compile-time assert that a range lies within a region */
+#define STATIC_ASSERT_WITHIN(start, size, region_start, region_size, message)                                          \
+	STATIC_ASSERT(((start) >= (region_start)) && ((start) + (size) <= (region_start) + (region_size)), message)
+
+/**
+ * \name Identifiers of the files using RUNTIME_ASSERT()
+ * \{
+ */
+#define ASSERT_FILE_NVMCTRL 1
+#define ASSERT_FILE_POWER_MANAGER 2
+#define ASSERT_FILE_WATCHDOG 3
+#define ASSERT_FILE_USART1 4
+/** \} */
+
+/**
+ * \brief Identifier of the file using RUNTIME_ASSERT()
+ *
+ * Define to one of the ASSERT_FILE_ values before including this header,
+ * 0 leaves the file to be found from the recorded program counter.
+ */
+#ifndef ASSERT_FILE_ID
+#define ASSERT_FILE_ID 0
+#endif
+
+/** Marks a valid assert_record_t */
+#define ASSERT_RECORD_MAGIC 0xA55E
+
+/** Failure recorded by RUNTIME_ASSERT(), kept across the watchdog reset */
+typedef struct {
+	uint16_t magic; ///< ASSERT_RECORD_MAGIC if the record is valid
+	uint8_t  file;  ///< ASSERT_FILE_ID of the failing file
+	uint16_t line;  ///< Line of the failing assert
+	uint32_t pc;    ///< Byte address of the call to ASSERT_Fail()
+	uint8_t  count; ///< Failures since the record was last cleared
+	uint16_t check; ///< Complement of line, guards against uninitialized SRAM
+} assert_record_t;
+
+void ASSERT_Fail(uint8_t file, uint16_t line) __attribute__((noreturn));
+
+bool ASSERT_GetRecord(assert_record_t *record);
+
+void ASSERT_ClearRecord(void);
+
+/**
+ * \brief Run-time assert
+ *
+ * On failure the file, line and program counter are stored in a record
+ * that survives the reset, and the watchdog resets the device. A check
+ * site compiles to the condition, three immediate loads and a call, as
+ * ASSERT_Fail() never returns.
+ *
+ * \param[in] condition A condition that must be true
+ */
+#define RUNTIME_ASSERT(condition)                                                                                      \
+	do {                                                                                                               \
+		if (!(condition)) {                                                                                            \
+			ASSERT_Fail(ASSERT_FILE_ID, __LINE__);                                                                     \
+		}                                                                                                              \
+	} while (0)
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,135 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#ifndef WATCHDOG_H_INCLUDED
+#define WATCHDOG_H_INCLUDED
+
+#include "../include/utils/compiler.h"
+#include "../include/timebase.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup doc_driver_watchdog Watchdog service
+ *
+ * Runs the WDT in window mode: a kick inside the closed window resets the
+ * device just like a missing kick, so a task stuck in a tight loop that
+ * keeps kicking is caught as well as one that hangs.
+ *
+ * Tasks that must stay alive register for a check-in bit and call
+ * WATCHDOG_CheckIn() once per cycle of their work. WATCHDOG_Service(), run
+ * as a scheduler task every WATCHDOG_SERVICE_PERIOD_US, kicks only after
+ * every registered task has checked in since the previous kick.
+ *
+ * Long blocking operations, e.g. the diagnostic memory tests, hold up the
+ * tasks and call WATCHDOG_Poll() between slices instead. It kicks as soon
+ * as the closed window is over, so a slice may take up to
+ * WATCHDOG_GetSliceLimitUs() without a reset.
+ *
+ * The WDT runs from the 1.024 kHz output of the internal 32.768 kHz
+ * oscillator. Its windows are converted to ticks with
+ * WATCHDOG_TOLERANCE_PERCENT of margin for the oscillator error, plus the
+ * synchronization of the previous kick. A kick is not issued while
+ * WDT.STATUS.SYNCBUSY is set, the WDT would ignore it.
+ *
+ *@{
+ */
+
+/** Compile and start the watchdog service from SYSTEM_Initialize() */
+#ifndef WATCHDOG_ENABLE
+#define WATCHDOG_ENABLE 1
+#endif
+
+/** WDT period, the open window in window mode */
+#ifndef WATCHDOG_PERIOD
+#define WATCHDOG_PERIOD WDT_PERIOD_1KCLK_gc
+#endif
+
+/** WDT closed window, WDT_WINDOW_OFF_gc for normal mode */
+#ifndef WATCHDOG_WINDOW
+#define WATCHDOG_WINDOW WDT_WINDOW_128CLK_gc
+#endif
+
+/** Error of the WDT oscillator allowed for, in percent */
+#ifndef WATCHDOG_TOLERANCE_PERCENT
+#define WATCHDOG_TOLERANCE_PERCENT 25
+#endif
+
+/** WDT cycles for a kick or configuration write to synchronize */
+#define WATCHDOG_SYNC_CYCLES 3
+
+/** Microseconds between runs of WATCHDOG_Service() */
+#ifndef WATCHDOG_SERVICE_PERIOD_US
+#define WATCHDOG_SERVICE_PERIOD_US 250000UL
+#endif
+
+/** Largest number of tasks checking in, one bit each */
+#define WATCHDOG_TASK_MAX 8
+
+void WATCHDOG_Initialize(void);
+
+void WATCHDOG_Enable(uint8_t period, uint8_t window);
+
+int8_t WATCHDOG_Register(void);
+
+void WATCHDOG_CheckIn(int8_t id);
+
+bool WATCHDOG_Service(void);
+
+bool WATCHDOG_Poll(void);
+
+uint32_t WATCHDOG_GetSliceLimitUs(void);
+
+uint32_t WATCHDOG_GetTimeoutUs(void);
+
+uint32_t WATCHDOG_TakeMaxKickGapUs(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WATCHDOG_H_INCLUDED */
@@ -0,0 +1,173 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#include "../include/clock_manager.h"
+#include "../include/ccp.h"
+#include "../include/utils/atomic.h"
+
+/** Oscillator frequency in MHz by FRQSEL value, 0 for reserved settings */
+static const uint8_t clock_oschf_mhz[16] = {1, 2, 3, 4, 0, 8, 12, 16, 20, 24, 0, 0, 0, 0, 0, 0};
+
+/** Division factor by PDIV value, 0 for reserved settings */
+static const uint8_t clock_pdiv_factor[16] = {2, 4, 8, 16, 32, 64, 0, 0, 6, 10, 12, 24, 48, 0, 0, 0};
+
+volatile uint32_t clock_frequency = F_CPU;
+
+volatile uint32_t clock_pll_frequency;
+
+static clock_consumer_t clock_consumers[CLOCK_CONSUMER_MAX];
+
+static uint8_t clock_consumer_count;
+
+/**
+ * \brief Register a function to be called after every clock change
+ *
+ * The consumer receives the new peripheral clock frequency in Hz. It is
+ * not called on registration, read clock_frequency for the initial value.
+ *
+ * \param[in] consumer The function to call
+ *
+ * \return 0 on success, -1 if the table is full
+ */
+int8_t CLOCK_RegisterConsumer(clock_consumer_t consumer)
+{
+	if (clock_consumer_count >= CLOCK_CONSUMER_MAX) {
+		return -1;
+	}
+
+	clock_consumers[clock_consumer_count++] = consumer;
+
+	return 0;
+}
+
+/**
+ * \brief Switch the internal oscillator frequency and the main prescaler
+ *
+ * Waits until the oscillator is stable and the main clock switch has
+ * completed, then updates clock_frequency and calls the consumers in the
+ * order they were registered. The oscillator never exceeds 24 MHz, so the
+ * order of the two register writes cannot overclock the CPU.
+ *
+ * \param[in] frqsel One of the CLKCTRL_FRQSEL_xM_gc values, 1 to 24 MHz
+ * \param[in] prescaler CLOCK_PRESCALER_NONE or CLOCK_PRESCALER(CLKCTRL_PDIV_xX_gc)
+ *
+ * \return 0 on success, -1 for a reserved setting
+ */
+int8_t CLOCK_SetFrequency(uint8_t frqsel, uint8_t prescaler)
+{
+	uint32_t frequency = (uint32_t)clock_oschf_mhz[(frqsel & CLKCTRL_FRQSEL_gm) >> CLKCTRL_FRQSEL_gp] * 1000000UL;
+	uint8_t  factor    = 1;
+
+	if (prescaler & CLKCTRL_PEN_bm) {
+		factor = clock_pdiv_factor[(prescaler & CLKCTRL_PDIV_gm) >> CLKCTRL_PDIV_gp];
+	}
+
+	if ((frequency == 0) || (factor == 0)) {
+		return -1;
+	}
+
+	CCP_WRITE_IO(CLKCTRL.OSCHFCTRLA, (CLKCTRL.OSCHFCTRLA & ~CLKCTRL_FRQSEL_gm) | (frqsel & CLKCTRL_FRQSEL_gm));
+	CCP_WRITE_IO(CLKCTRL.MCLKCTRLB, prescaler & (CLKCTRL_PDIV_gm | CLKCTRL_PEN_bm));
+
+	while (!(CLKCTRL.MCLKSTATUS & CLKCTRL_OSCHFS_bm) || (CLKCTRL.MCLKSTATUS & CLKCTRL_SOSC_bm)) {
+	}
+
+	ENTER_CRITICAL(F);
+	clock_frequency = frequency / factor;
+	EXIT_CRITICAL(F);
+
+	for (uint8_t i = 0; i < clock_consumer_count; i++) {
+		clock_consumers[i](frequency / factor);
+	}
+
+	return 0;
+}
+
+/**
+ * \brief Start or stop the PLL
+ *
+ * The PLL multiplies the internal oscillator and clocks TCD only. The
+ * consumers are not called, the peripheral clock does not change.
+ *
+ * \param[in] mulfac CLKCTRL_MULFAC_DISABLE_gc, CLKCTRL_MULFAC_2x_gc or CLKCTRL_MULFAC_3x_gc
+ *
+ * \return 0 on success, -1 for a reserved setting
+ */
+int8_t CLOCK_SetPll(uint8_t mulfac)
+{
+	uint8_t  factor = mulfac & CLKCTRL_MULFAC_gm;
+	uint32_t oschf  = (uint32_t)clock_oschf_mhz[(CLKCTRL.OSCHFCTRLA & CLKCTRL_FRQSEL_gm) >> CLKCTRL_FRQSEL_gp] * 1000000UL;
+
+	if (factor > 2) {
+		return -1;
+	}
+
+	//RUNSTDBY disabled; SOURCE OSCHF;
+	CCP_WRITE_IO(CLKCTRL.PLLCTRLA, factor);
+
+	if (factor != 0) {
+		while (!(CLKCTRL.MCLKSTATUS & CLKCTRL_PLLS_bm)) {
+		}
+		clock_pll_frequency = oschf * (factor + 1);
+	} else {
+		clock_pll_frequency = 0;
+	}
+
+	return 0;
+}
+
+/**
+ * \brief Peripheral clock frequency in Hz, read atomically
+ *
+ * \return The frequency
+ */
+uint32_t CLOCK_GetFrequency(void)
+{
+	uint32_t frequency;
+
+	ENTER_CRITICAL(R);
+	frequency = clock_frequency;
+	EXIT_CRITICAL(R);
+
+	return frequency;
+}
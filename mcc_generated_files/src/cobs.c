@@ -0,0 +1,114 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#include "../include/cobs.h"
+
+/**
+ * \brief Encode a block
+ *
+ * \param[in] src Block to encode
+ * \param[in] size Number of bytes in src
+ * \param[out] dst Encoded block, COBS_ENCODED_MAX(size) bytes of room
+ *
+ * \return Number of bytes written to dst
+ */
+size_t COBS_Encode(const uint8_t *src, size_t size, uint8_t *dst)
+{
+	size_t  code_at = 0;
+	size_t  out     = 1;
+	uint8_t code    = 1;
+
+	while (size--) {
+		uint8_t data = *src++;
+
+		if (data == 0) {
+			dst[code_at] = code;
+			code_at      = out++;
+			code         = 1;
+		} else {
+			dst[out++] = data;
+			if (++code == 0xFF) {
+				dst[code_at] = code;
+				code_at      = out++;
+				code         = 1;
+			}
+		}
+	}
+	dst[code_at] = code;
+
+	return out;
+}
+
+/**
+ * \brief Decode a block
+ *
+ * \param[in] src Encoded block, without the delimiter
+ * \param[in] size Number of bytes in src
+ * \param[out] dst Decoded block, size bytes of room
+ *
+ * \return Number of bytes written to dst, 0 if src is not valid COBS
+ */
+size_t COBS_Decode(const uint8_t *src, size_t size, uint8_t *dst)
+{
+	size_t in  = 0;
+	size_t out = 0;
+
+	while (in < size) {
+		uint8_t code = src[in++];
+
+		if (code == 0) {
+			return 0;
+		}
+		for (uint8_t i = 1; i < code; i++) {
+			if ((in >= size) || (src[in] == 0)) {
+				return 0;
+			}
+			dst[out++] = src[in++];
+		}
+		if ((code != 0xFF) && (in < size)) {
+			dst[out++] = 0;
+		}
+	}
+
+	return out;
+}
@@ -0,0 +1,294 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#include "../include/config_store.h"
+#include "../include/crc.h"
+#include "../include/utils/utils_assert.h"
+
+/** Value of the commit marker of a completely written slot */
+#define CONFIG_STORE_COMMIT 0xA55AU
+
+/** No slot holds a committed configuration */
+#define CONFIG_STORE_NO_SLOT 0xFF
+
+/** Flash address of the header of a slot */
+#define CONFIG_STORE_HEADER_ADDRESS(slot) (config_store_slot[(slot)] + CONFIG_STORE_SLOT_SIZE - CONFIG_STORE_HEADER_SIZE)
+
+/** Slot header, stored at the end of the slot. commit must stay the last member. */
+typedef struct {
+	uint32_t sequence; ///< Incremented by every save, compared with wrap-around.
+	uint16_t length;   ///< Number of payload bytes at the start of the slot.
+	uint16_t crc;      ///< CRC16 of the payload.
+	uint16_t commit;   ///< CONFIG_STORE_COMMIT once header and payload are complete.
+} config_store_header_t;
+
+STATIC_ASSERT_ALIGNED(CONFIG_STORE_SLOT_SIZE, PROGMEM_PAGE_SIZE, config_store_slot_not_whole_pages);
+STATIC_ASSERT_ALIGNED(CONFIG_STORE_SLOT_A_ADDRESS, PROGMEM_PAGE_SIZE, config_store_slot_a_not_page_aligned);
+STATIC_ASSERT_ALIGNED(CONFIG_STORE_SLOT_B_ADDRESS, PROGMEM_PAGE_SIZE, config_store_slot_b_not_page_aligned);
+STATIC_ASSERT_WITHIN(CONFIG_STORE_SLOT_A_ADDRESS, CONFIG_STORE_SLOT_SIZE, FLASH_APPDATA_START, FLASH_APPDATA_SIZE, config_store_slot_a_outside_appdata);
+STATIC_ASSERT_WITHIN(CONFIG_STORE_SLOT_B_ADDRESS, CONFIG_STORE_SLOT_SIZE, FLASH_APPDATA_START, FLASH_APPDATA_SIZE, config_store_slot_b_outside_appdata);
+STATIC_ASSERT_NO_OVERLAP(CONFIG_STORE_SLOT_A_ADDRESS, CONFIG_STORE_SLOT_SIZE, CONFIG_STORE_SLOT_B_ADDRESS, CONFIG_STORE_SLOT_SIZE, config_store_slots_overlap);
+
+static const flash_adr_t config_store_slot[2] = {CONFIG_STORE_SLOT_A_ADDRESS, CONFIG_STORE_SLOT_B_ADDRESS};
+
+/** Slot holding the newest configuration, or CONFIG_STORE_NO_SLOT */
+static uint8_t config_store_active = CONFIG_STORE_NO_SLOT;
+
+/** Sequence number of the newest configuration */
+static uint32_t config_store_sequence;
+
+static void CONFIG_STORE_ReadHeader(uint8_t slot, config_store_header_t *header)
+{
+	uint8_t *   bytes = (uint8_t *)header;
+	flash_adr_t adr   = CONFIG_STORE_HEADER_ADDRESS(slot);
+
+	for (uint8_t i = 0; i < sizeof(config_store_header_t); i++) {
+		bytes[i] = FLASH_ReadFlashByte(adr + i);
+	}
+}
+
+static bool CONFIG_STORE_IsCommitted(const config_store_header_t *header)
+{
+	return (header->commit == CONFIG_STORE_COMMIT) && (header->length <= CONFIG_STORE_PAYLOAD_MAX);
+}
+
+/**
+ * \brief Check the payload of a slot against its header CRC
+ *
+ * \param[in] slot The slot to check
+ * \param[in] header The header of the slot
+ * \param[out] data Buffer receiving up to size payload bytes, may be NULL
+ * \param[in] size Size of the buffer
+ *
+ * \return true if the payload matches the CRC
+ */
+static bool CONFIG_STORE_VerifySlot(uint8_t slot, const config_store_header_t *header, uint8_t *data, uint16_t size)
+{
+	flash_adr_t adr = config_store_slot[slot];
+	uint16_t    crc = CRC16_INITIAL;
+	uint8_t     byte;
+
+	for (uint16_t i = 0; i < header->length; i++) {
+		byte = FLASH_ReadFlashByte(adr + i);
+		crc  = CRC16_UpdateByte(crc, byte);
+		if ((data != NULL) && (i < size)) {
+			data[i] = byte;
+		}
+	}
+
+	return crc == header->crc;
+}
+
+/**
+ * \brief Select the newest slot that is committed and passes its CRC
+ *
+ * The older slot is used when the newer one does not verify, as in
+ * CONFIG_STORE_Load(). Sequence numbers are compared with wrap-around, so
+ * the store keeps working after 2^32 saves.
+ *
+ * \return Nothing
+ */
+static void CONFIG_STORE_SelectSlot(void)
+{
+	config_store_header_t header[2];
+	uint8_t               newest;
+	uint8_t               slot;
+
+	for (slot = 0; slot < 2; slot++) {
+		CONFIG_STORE_ReadHeader(slot, &header[slot]);
+	}
+	newest = ((int32_t)(header[1].sequence - header[0].sequence) > 0) ? 1 : 0;
+
+	config_store_active   = CONFIG_STORE_NO_SLOT;
+	config_store_sequence = 0;
+
+	for (uint8_t attempt = 0; attempt < 2; attempt++) {
+		slot = newest ^ attempt;
+		if (CONFIG_STORE_IsCommitted(&header[slot]) && CONFIG_STORE_VerifySlot(slot, &header[slot], NULL, 0)) {
+			config_store_active   = slot;
+			config_store_sequence = header[slot].sequence;
+			return;
+		}
+	}
+}
+
+/**
+ * \brief Select the newest valid slot
+ *
+ * Both the headers and the payload CRC are checked, so a save that follows
+ * without a CONFIG_STORE_Load() still keeps the good copy.
+ *
+ * \return Nothing
+ */
+void CONFIG_STORE_Initialize(void)
+{
+	CONFIG_STORE_SelectSlot();
+}
+
+/**
+ * \brief Read the newest configuration that passes its CRC
+ *
+ * If the newest slot does not verify, the older one is tried and becomes the
+ * current slot, so the next save overwrites the damaged copy.
+ *
+ * \param[out] data Buffer receiving the configuration. Bytes past the stored
+ *                  length are left unchanged. The content is undefined if
+ *                  CONFIG_STORE_ERROR is returned.
+ * \param[in] size Size of the buffer
+ *
+ * \return Status of the operation
+ */
+config_store_status_t CONFIG_STORE_Load(uint8_t *data, uint16_t size)
+{
+	config_store_header_t header;
+	uint8_t               slot = config_store_active;
+
+	if (slot == CONFIG_STORE_NO_SLOT) {
+		return CONFIG_STORE_EMPTY;
+	}
+
+	for (uint8_t attempt = 0; attempt < 2; attempt++) {
+		CONFIG_STORE_ReadHeader(slot, &header);
+		if (CONFIG_STORE_IsCommitted(&header) && CONFIG_STORE_VerifySlot(slot, &header, data, size)) {
+			config_store_active   = slot;
+			config_store_sequence = header.sequence;
+			return CONFIG_STORE_OK;
+		}
+		slot ^= 1;
+	}
+
+	return CONFIG_STORE_ERROR;
+}
+
+/**
+ * \brief Write a new configuration to the slot not holding the current one
+ *
+ * The current configuration stays valid until the commit marker of the new
+ * slot has been programmed, so a power cut during the save loses at most the
+ * new configuration. The slots are verified again first, so the slot that is
+ * kept is the newest one that passes its CRC, even if it changed since
+ * CONFIG_STORE_Initialize().
+ *
+ * \param[in] data The configuration to store
+ * \param[in] size Number of bytes, at most CONFIG_STORE_PAYLOAD_MAX
+ *
+ * \return Status of the operation
+ */
+config_store_status_t CONFIG_STORE_Save(const uint8_t *data, uint16_t size)
+{
+	uint8_t               slot;
+	flash_adr_t           base;
+	flash_adr_t           header_adr;
+	config_store_header_t header;
+	nvmctrl_writer_t      writer;
+	const uint8_t *       bytes;
+	uint16_t              done = 0;
+
+	if (size > CONFIG_STORE_PAYLOAD_MAX) {
+		return CONFIG_STORE_ERROR;
+	}
+
+	CONFIG_STORE_SelectSlot();
+	slot       = (config_store_active == 0) ? 1 : 0;
+	base       = config_store_slot[slot];
+	header_adr = CONFIG_STORE_HEADER_ADDRESS(slot);
+
+	/* Invalidate the target slot before any of its payload changes */
+	if (FLASH_EraseFlashPage(header_adr & ~((flash_adr_t)PROGMEM_PAGE_SIZE - 1)) != NVM_OK) {
+		return CONFIG_STORE_ERROR;
+	}
+
+	/* Whole payload pages go straight from the caller's buffer */
+	while (size - done >= PROGMEM_PAGE_SIZE) {
+		if (FLASH_WriteFlashPage(base + done, (uint8_t *)data + done) != NVM_OK) {
+			return CONFIG_STORE_ERROR;
+		}
+		done += PROGMEM_PAGE_SIZE;
+	}
+
+	/* The tail starts page aligned, so the writer erases its page first */
+	if (done < size) {
+		FLASH_WriterOpen(&writer, NVM_TARGET_FLASH, base + done, size - done);
+		while (done < size) {
+			FLASH_WriterPush(&writer, data[done++]);
+		}
+		if (FLASH_WriterFlush(&writer) != NVM_OK) {
+			return CONFIG_STORE_ERROR;
+		}
+	}
+
+	header.sequence = config_store_sequence + 1;
+	header.length   = size;
+	header.crc      = CRC16_Update(CRC16_INITIAL, data, size);
+	header.commit   = CONFIG_STORE_COMMIT;
+
+	/* The header is not page aligned, so the writer programs the erased area without erasing it.
+	 * The bytes go out in member order, which puts the commit marker last. */
+	bytes = (const uint8_t *)&header;
+	FLASH_WriterOpen(&writer, NVM_TARGET_FLASH, header_adr, sizeof(header));
+	for (uint8_t i = 0; i < sizeof(header); i++) {
+		FLASH_WriterPush(&writer, bytes[i]);
+	}
+	if (FLASH_WriterFlush(&writer) != NVM_OK) {
+		return CONFIG_STORE_ERROR;
+	}
+
+	if (!CONFIG_STORE_VerifySlot(slot, &header, NULL, 0)) {
+		return CONFIG_STORE_ERROR;
+	}
+
+	config_store_active   = slot;
+	config_store_sequence = header.sequence;
+
+	return CONFIG_STORE_OK;
+}
+
+/**
+ * \brief Sequence number of the current configuration, 0 if none was saved
+ *
+ * \return The sequence number
+ */
+uint32_t CONFIG_STORE_GetSequence(void)
+{
+	return config_store_sequence;
+}
@@ -51,8 +51,8 @@ int8_t CPUINT_Initialize()
 {
     /* IVSEL and CVT are Configuration Change Protected */
 
-    //IVSEL disabled; CVT disabled; LVL0RR disabled; 
-    ccp_write_io((void*)&(CPUINT.CTRLA),0x0);
+    //IVSEL enabled, the application runs from BOOT; CVT disabled; LVL0RR disabled; 
+    CCP_WRITE_IO(CPUINT.CTRLA,CPUINT_IVSEL_bm);
     
     //LVL0PRI 0; 
     CPUINT.LVL0PRI = 0x0;
@@ -62,4 +62,74 @@ int8_t CPUINT_Initialize()
 
         
     return 0;
+}
+
+/**
+ * \brief Update bits of the CCP-protected CPUINT.CTRLA
+ *
+ * \param[in] mask Bits to update
+ * \param[in] value New value of the bits
+ */
+static void CPUINT_UpdateCtrlA(uint8_t mask, uint8_t value)
+{
+    ENTER_CRITICAL(C);
+    CCP_WRITE_IO(CPUINT.CTRLA, (CPUINT.CTRLA & ~mask) | (value & mask));
+    EXIT_CRITICAL(C);
+}
+
+/**
+ * \brief Assign level 1 priority to one interrupt vector
+ *
+ * A level 1 interrupt preempts any level 0 ISR, so its worst-case latency
+ * no longer depends on the length of the other handlers. Only one vector
+ * can be level 1; 0 returns all vectors to level 0.
+ *
+ * \param[in] vector_num Vector number, e.g. TCB0_INT_vect_num
+ */
+void CPUINT_SetLevel1Vector(uint8_t vector_num)
+{
+    CPUINT.LVL1VEC = vector_num;
+}
+
+/**
+ * \brief Set the level 0 vector with the lowest priority
+ *
+ * Level 0 vectors are prioritized from vector_num + 1 (highest), wrapping
+ * around to vector_num (lowest). Round-robin scheduling updates this
+ * register after every level 0 interrupt.
+ *
+ * \param[in] vector_num Vector number
+ */
+void CPUINT_SetLevel0Priority(uint8_t vector_num)
+{
+    CPUINT.LVL0PRI = vector_num;
+}
+
+/**
+ * \brief Enable or disable round-robin scheduling of level 0 interrupts
+ *
+ * With round robin the last served level 0 vector gets the lowest priority,
+ * so no pending level 0 interrupt waits for more than one handler of each
+ * other source.
+ *
+ * \param[in] enable true to enable
+ */
+void CPUINT_SetRoundRobin(bool enable)
+{
+    CPUINT_UpdateCtrlA(CPUINT_LVL0RR_bm, enable ? CPUINT_LVL0RR_bm : 0);
+}
+
+/**
+ * \brief Enable or disable the compact vector table
+ *
+ * With CVT the table holds NMI, the level 1 vector and a single vector for
+ * all level 0 interrupts, which then has to find the source itself. The
+ * application must be linked with a matching vector table, the normal
+ * ISR() vectors are no longer used for level 0 sources.
+ *
+ * \param[in] enable true to enable
+ */
+void CPUINT_SetCompactVectorTable(bool enable)
+{
+    CPUINT_UpdateCtrlA(CPUINT_CVT_bm, enable ? CPUINT_CVT_bm : 0);
 }
\ No newline at end of file
@@ -0,0 +1,160 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#include "../include/debounce.h"
+#include "../include/utils/atomic.h"
+
+/** VPORT input register of a port, VPORT instances are 4 bytes apart */
+#define DEBOUNCE_VPORT_IN(port) (*(&VPORTA.IN + 4 * (port)))
+
+/** Debounce state of one port, one bit per pin in every member */
+typedef struct {
+	uint8_t state;   ///< Debounced level
+	uint8_t ct0;     ///< Counter bit 0
+	uint8_t ct1;     ///< Counter bit 1
+	uint8_t rising;  ///< Pins that became high since the last fetch
+	uint8_t falling; ///< Pins that became low since the last fetch
+} debounce_port_t;
+
+static volatile debounce_port_t debounce_port[DEBOUNCE_PORT_COUNT];
+
+/**
+ * \brief Take the current pin levels as debounced state and clear all events
+ *
+ * \return Nothing
+ */
+void DEBOUNCE_Initialize(void)
+{
+	for (uint8_t port = 0; port < DEBOUNCE_PORT_COUNT; port++) {
+		debounce_port[port].state   = DEBOUNCE_VPORT_IN(port);
+		debounce_port[port].ct0     = 0xFF;
+		debounce_port[port].ct1     = 0xFF;
+		debounce_port[port].rising  = 0;
+		debounce_port[port].falling = 0;
+	}
+}
+
+/**
+ * \brief Sample all ports and advance the vertical counters
+ *
+ * A pin whose sample equals its debounced state has its counter reset to 3.
+ * Otherwise the counter counts down, and the tick on which it wraps from 0
+ * to 3 toggles the debounced state and records the edge.
+ *
+ * \return Nothing
+ */
+void DEBOUNCE_Tick(void)
+{
+	volatile debounce_port_t *p = debounce_port;
+	uint8_t                   changed;
+	uint8_t                   ct0;
+	uint8_t                   ct1;
+	uint8_t                   state;
+
+	for (uint8_t port = 0; port < DEBOUNCE_PORT_COUNT; port++, p++) {
+		state   = p->state;
+		changed = state ^ DEBOUNCE_VPORT_IN(port);
+		ct0     = ~(p->ct0 & changed);
+		ct1     = ct0 ^ (p->ct1 & changed);
+		changed &= ct0 & ct1;
+		state ^= changed;
+
+		p->ct0   = ct0;
+		p->ct1   = ct1;
+		p->state = state;
+		if (changed) {
+			p->rising |= state & changed;
+			p->falling |= ~state & changed;
+		}
+	}
+}
+
+/**
+ * \brief Debounced level of the pins of a port
+ *
+ * \param[in] port Port index, 0 for PORTA
+ *
+ * \return One bit per pin
+ */
+uint8_t DEBOUNCE_GetState(uint8_t port)
+{
+	return debounce_port[port].state;
+}
+
+/**
+ * \brief Fetch and clear the rising edges of a port
+ *
+ * \param[in] port Port index, 0 for PORTA
+ *
+ * \return Pins that became high since the previous call
+ */
+uint8_t DEBOUNCE_GetRising(uint8_t port)
+{
+	uint8_t edges;
+
+	ENTER_CRITICAL(R);
+	edges                      = debounce_port[port].rising;
+	debounce_port[port].rising = 0;
+	EXIT_CRITICAL(R);
+
+	return edges;
+}
+
+/**
+ * \brief Fetch and clear the falling edges of a port
+ *
+ * \param[in] port Port index, 0 for PORTA
+ *
+ * \return Pins that became low since the previous call
+ */
+uint8_t DEBOUNCE_GetFalling(uint8_t port)
+{
+	uint8_t edges;
+
+	ENTER_CRITICAL(F);
+	edges                       = debounce_port[port].falling;
+	debounce_port[port].falling = 0;
+	EXIT_CRITICAL(F);
+
+	return edges;
+}
@@ -43,6 +43,7 @@ Copyright (c) [2012-2020] Microchip Technology Inc.
 
 
 #include <avr/io.h>
+#include "../include/nvmctrl.h"
 
 /**
  * Configures Fuse bits
@@ -51,8 +52,8 @@ Copyright (c) [2012-2020] Microchip Technology Inc.
 FUSES = 
 {
   .BODCFG = ACTIVE_DISABLE_gc | LVL_BODLEVEL0_gc | SAMPFREQ_128Hz_gc | SLEEP_DISABLE_gc,
-  .BOOTSIZE = 0,
-  .CODESIZE = 0,
+  .BOOTSIZE = FLASH_BOOT_BLOCKS,
+  .CODESIZE = FLASH_BOOT_BLOCKS,
   .OSCCFG = CLKSEL_OSCHF_gc,
   .SYSCFG0 = CRCSEL_CRC16_gc | CRCSRC_NOCRC_gc | RSTPINCFG_GPIO_gc,
   .SYSCFG1 = SUT_0MS_gc,
@@ -0,0 +1,322 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#include "../include/event_log.h"
+#include "../include/crc.h"
+#include "../include/utils/utils_assert.h"
+#include <stddef.h>
+
+/** First address past the ring */
+#define EVENT_LOG_END_ADDRESS (EVENT_LOG_START_ADDRESS + (flash_adr_t)EVENT_LOG_PAGES * PROGMEM_PAGE_SIZE)
+
+/** Flash address of a record slot of a page */
+#define EVENT_LOG_RECORD_ADDRESS(page, index) \
+	(EVENT_LOG_START_ADDRESS + (flash_adr_t)(page) * PROGMEM_PAGE_SIZE + (flash_adr_t)(index) * EVENT_LOG_RECORD_SIZE)
+
+/** No page has been erased ahead of the cursor */
+#define EVENT_LOG_NO_PAGE ((flash_adr_t)-1)
+
+STATIC_ASSERT(EVENT_LOG_PAGES >= 2, event_log_too_few_pages);
+STATIC_ASSERT(EVENT_LOG_ERASE_AHEAD < PROGMEM_PAGE_SIZE, event_log_erase_ahead_past_page);
+STATIC_ASSERT_ALIGNED(EVENT_LOG_START_ADDRESS, PROGMEM_PAGE_SIZE, event_log_not_page_aligned);
+STATIC_ASSERT((PROGMEM_PAGE_SIZE % EVENT_LOG_RECORD_SIZE) == 0, event_log_record_straddles_pages);
+STATIC_ASSERT_WITHIN(EVENT_LOG_START_ADDRESS, EVENT_LOG_END_ADDRESS - EVENT_LOG_START_ADDRESS, FLASH_APPDATA_START, FLASH_APPDATA_SIZE, event_log_outside_appdata);
+STATIC_ASSERT_NO_OVERLAP(EVENT_LOG_START_ADDRESS, EVENT_LOG_END_ADDRESS - EVENT_LOG_START_ADDRESS, CONFIG_STORE_SLOT_A_ADDRESS, CONFIG_STORE_SLOT_SIZE, event_log_overlaps_config_slot_a);
+STATIC_ASSERT_NO_OVERLAP(EVENT_LOG_START_ADDRESS, EVENT_LOG_END_ADDRESS - EVENT_LOG_START_ADDRESS, CONFIG_STORE_SLOT_B_ADDRESS, CONFIG_STORE_SLOT_SIZE, event_log_overlaps_config_slot_b);
+
+/** Writer positioned at the cursor, left open between appends */
+static nvmctrl_writer_t event_log_writer;
+
+/** Flash address the next record goes to */
+static flash_adr_t event_log_cursor;
+
+/** Sequence number of the next record */
+static uint32_t event_log_sequence;
+
+/** Start of the page erased ahead of the cursor, or EVENT_LOG_NO_PAGE */
+static flash_adr_t event_log_erased = EVENT_LOG_NO_PAGE;
+
+static void EVENT_LOG_ReadRecord(flash_adr_t adr, event_log_record_t *record)
+{
+	uint8_t *bytes = (uint8_t *)record;
+
+	for (uint8_t i = 0; i < EVENT_LOG_RECORD_SIZE; i++) {
+		bytes[i] = FLASH_ReadFlashByte(adr + i);
+	}
+}
+
+static bool EVENT_LOG_IsValid(const event_log_record_t *record)
+{
+	return record->check == CRC16_Update(CRC16_INITIAL, (const uint8_t *)record, offsetof(event_log_record_t, check));
+}
+
+/**
+ * \brief Check if a record slot has been programmed at all
+ *
+ * A torn record is not blank even though it is not valid, the cursor has to
+ * move past it.
+ */
+static bool EVENT_LOG_IsBlank(flash_adr_t adr)
+{
+	for (uint8_t i = 0; i < EVENT_LOG_RECORD_SIZE; i++) {
+		if (FLASH_ReadFlashByte(adr + i) != 0xFF) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * \brief Sequence number of the first record of a page
+ *
+ * \return false if the page is erased or its first record is not valid
+ */
+static bool EVENT_LOG_PageSequence(uint8_t page, uint32_t *sequence)
+{
+	event_log_record_t record;
+
+	EVENT_LOG_ReadRecord(EVENT_LOG_RECORD_ADDRESS(page, 0), &record);
+	*sequence = record.sequence;
+
+	return EVENT_LOG_IsValid(&record);
+}
+
+static nvmctrl_status_t EVENT_LOG_OpenWriter(void)
+{
+	return FLASH_WriterOpen(&event_log_writer, NVM_TARGET_FLASH, event_log_cursor, EVENT_LOG_END_ADDRESS - event_log_cursor);
+}
+
+/**
+ * \brief Start erasing the page after the cursor once the cursor is far enough into its page
+ *
+ * Does not wait. If the controller is busy, the next append tries again.
+ */
+static void EVENT_LOG_EraseAhead(void)
+{
+	flash_adr_t page = event_log_cursor & ~((flash_adr_t)PROGMEM_PAGE_SIZE - 1);
+	flash_adr_t next = page + PROGMEM_PAGE_SIZE;
+
+	if ((event_log_cursor - page) < EVENT_LOG_ERASE_AHEAD) {
+		return;
+	}
+
+	if (next >= EVENT_LOG_END_ADDRESS) {
+		next = EVENT_LOG_START_ADDRESS;
+	}
+
+	if ((next != event_log_erased) && (FLASH_StartEraseFlashPage(next) == NVM_OK)) {
+		event_log_erased = next;
+	}
+}
+
+/**
+ * \brief Locate the write cursor of the log
+ *
+ * Pages are filled in ring order, so walking from page 0 the first-record
+ * sequence numbers increase up to the newest page and are then erased or
+ * older. Whether a page is at or after page 0 in sequence is therefore a
+ * prefix property, and the newest page is found by binary search. Within the
+ * newest page the programmed records form a prefix as well.
+ *
+ * A page whose first record is invalid counts as erased: it is the page
+ * erased ahead of the cursor, or the page a power cut interrupted right after
+ * its erase or during its first record, and it is erased again when the
+ * cursor enters it.
+ *
+ * \return Status of the operation
+ */
+nvmctrl_status_t EVENT_LOG_Initialize(void)
+{
+	uint32_t base;
+	uint32_t sequence;
+	uint8_t  newest;
+	uint8_t  low;
+	uint8_t  high;
+	uint8_t  mid;
+
+	event_log_erased = EVENT_LOG_NO_PAGE;
+
+	if (!EVENT_LOG_PageSequence(0, &base)) {
+		/* Page 0 is erased: the log is empty, or it wrapped and page 0 was erased ahead of the cursor */
+		if (!EVENT_LOG_PageSequence(EVENT_LOG_PAGES - 1, &sequence)) {
+			event_log_cursor   = EVENT_LOG_START_ADDRESS;
+			event_log_sequence = 0;
+			return EVENT_LOG_OpenWriter();
+		}
+		newest = EVENT_LOG_PAGES - 1;
+	} else {
+		/* Last page that is valid and not older than page 0 */
+		low  = 0;
+		high = EVENT_LOG_PAGES - 1;
+		while (low < high) {
+			mid = (uint8_t)((low + high + 1) / 2);
+			if (EVENT_LOG_PageSequence(mid, &sequence) && ((int32_t)(sequence - base) > 0)) {
+				low = mid;
+			} else {
+				high = mid - 1;
+			}
+		}
+		newest = low;
+		EVENT_LOG_PageSequence(newest, &sequence);
+	}
+
+	/* First blank record slot of the newest page, the first slot is known to be valid */
+	low  = 1;
+	high = EVENT_LOG_RECORDS_PER_PAGE;
+	while (low < high) {
+		mid = (uint8_t)((low + high) / 2);
+		if (EVENT_LOG_IsBlank(EVENT_LOG_RECORD_ADDRESS(newest, mid))) {
+			high = mid;
+		} else {
+			low = mid + 1;
+		}
+	}
+
+	event_log_sequence = sequence + low;
+	event_log_cursor   = EVENT_LOG_RECORD_ADDRESS(newest, low);
+	if (event_log_cursor >= EVENT_LOG_END_ADDRESS) {
+		event_log_cursor = EVENT_LOG_START_ADDRESS;
+	}
+
+	return EVENT_LOG_OpenWriter();
+}
+
+/**
+ * \brief Append one record at the cursor
+ *
+ * Programs EVENT_LOG_RECORD_SIZE bytes at the cursor, the check member last.
+ * A page not erased ahead is erased first when the cursor is at its start.
+ * Afterwards starts erasing the next page if the cursor has passed
+ * EVENT_LOG_ERASE_AHEAD. Not reentrant, appends must come from one context.
+ *
+ * \param[in] timestamp Time of the event
+ * \param[in] source Module reporting the event
+ * \param[in] code Event or fault code
+ * \param[in] detail Additional information
+ *
+ * \return Status of the operation
+ */
+nvmctrl_status_t EVENT_LOG_Append(uint32_t timestamp, uint8_t source, uint8_t code, uint16_t detail)
+{
+	event_log_record_t record;
+	const uint8_t *    bytes = (const uint8_t *)&record;
+
+	record.sequence    = event_log_sequence;
+	record.timestamp   = timestamp;
+	record.source      = source;
+	record.code        = code;
+	record.detail      = detail;
+	record.reserved[0] = 0xFF;
+	record.reserved[1] = 0xFF;
+	record.check       = CRC16_Update(CRC16_INITIAL, bytes, offsetof(event_log_record_t, check));
+
+	/* The slot is consumed even if programming fails, a torn record is skipped by readers */
+	event_log_sequence++;
+
+	/* Entering the page erased ahead, keep the writer from erasing it again */
+	if (event_log_cursor == event_log_erased) {
+		event_log_writer.page = event_log_erased;
+		event_log_erased      = EVENT_LOG_NO_PAGE;
+	}
+
+	for (uint8_t i = 0; i < EVENT_LOG_RECORD_SIZE; i++) {
+		FLASH_WriterPush(&event_log_writer, bytes[i]);
+	}
+
+	event_log_cursor += EVENT_LOG_RECORD_SIZE;
+	if (event_log_cursor >= EVENT_LOG_END_ADDRESS) {
+		event_log_cursor = EVENT_LOG_START_ADDRESS;
+		if (FLASH_WriterFlush(&event_log_writer) != NVM_OK) {
+			EVENT_LOG_OpenWriter();
+			return NVM_ERROR;
+		}
+		return EVENT_LOG_OpenWriter();
+	}
+
+	if (event_log_writer.state != NVM_WRITER_OPEN) {
+		/* Keep logging after a failed record */
+		EVENT_LOG_OpenWriter();
+		return NVM_ERROR;
+	}
+
+	EVENT_LOG_EraseAhead();
+
+	return NVM_OK;
+}
+
+/**
+ * \brief Read a record by age
+ *
+ * \param[in] age 0 for the newest record, 1 for the one before and so on
+ * \param[out] record The record read
+ *
+ * \return false if the record has been overwritten, was never written or is torn
+ */
+bool EVENT_LOG_Read(uint16_t age, event_log_record_t *record)
+{
+	flash_adr_t offset = event_log_cursor - EVENT_LOG_START_ADDRESS;
+	flash_adr_t back   = ((flash_adr_t)age + 1) * EVENT_LOG_RECORD_SIZE;
+
+	if ((uint32_t)age >= event_log_sequence || back > (flash_adr_t)EVENT_LOG_PAGES * PROGMEM_PAGE_SIZE) {
+		return false;
+	}
+
+	if (back > offset) {
+		offset += (flash_adr_t)EVENT_LOG_PAGES * PROGMEM_PAGE_SIZE;
+	}
+
+	EVENT_LOG_ReadRecord(EVENT_LOG_START_ADDRESS + offset - back, record);
+
+	return EVENT_LOG_IsValid(record) && (record->sequence == event_log_sequence - 1 - age);
+}
+
+/**
+ * \brief Sequence number the next record will get
+ *
+ * \return The sequence number
+ */
+uint32_t EVENT_LOG_GetSequence(void)
+{
+	return event_log_sequence;
+}
@@ -0,0 +1,214 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#include "../include/format.h"
+#include "../include/usart1.h"
+
+/** Longest decimal output: sign, 10 digits, decimal point and leading zero */
+#define FMT_DECIMAL_MAX 13
+
+/** Powers of ten for the digits above the units, most significant first */
+static const uint32_t fmt_pow10[] PROGMEM = {
+	1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL, 10000UL, 1000UL, 100UL, 10UL};
+
+static const char fmt_hex[] PROGMEM = "0123456789ABCDEF";
+
+/**
+ * \brief Queue a formatted item, as much in one go as the buffer takes
+ *
+ * \param[in] buf Characters to queue
+ * \param[in] size Number of characters
+ */
+static void FMT_Write(const char *buf, uint8_t size)
+{
+	uint8_t queued = USART1_WriteBuffer((const uint8_t *)buf, size);
+
+	/* The rest goes byte by byte, USART1_Write() applies the full-buffer policy */
+	while (queued < size) {
+		USART1_Write((uint8_t)buf[queued++]);
+	}
+}
+
+/**
+ * \brief Convert a magnitude to decimal digits
+ *
+ * \param[out] buf Destination, FMT_DECIMAL_MAX - 1 characters at least
+ * \param[in] value Magnitude, scaled by 10^decimals
+ * \param[in] decimals Digits after the decimal point, 0 to 9
+ *
+ * \return Number of characters written
+ */
+static uint8_t FMT_Decimal(char *buf, uint32_t value, uint8_t decimals)
+{
+	uint8_t n       = 0;
+	bool    leading = true;
+
+	for (uint8_t i = 0; i < sizeof(fmt_pow10) / sizeof(fmt_pow10[0]); i++) {
+		uint32_t pow   = pgm_read_dword(&fmt_pow10[i]);
+		uint8_t  place = sizeof(fmt_pow10) / sizeof(fmt_pow10[0]) - i;
+		char     digit = '0';
+
+		while (value >= pow) {
+			value -= pow;
+			digit++;
+		}
+
+		if ((digit != '0') || (place <= decimals)) {
+			leading = false;
+		}
+		if (!leading) {
+			buf[n++] = digit;
+			if (place == decimals) {
+				buf[n++] = '.';
+			}
+		}
+	}
+	buf[n++] = '0' + (uint8_t)value;
+
+	return n;
+}
+
+/**
+ * \brief Queue one character
+ *
+ * \param[in] c Character
+ */
+void FMT_PutChar(char c)
+{
+	USART1_Write((uint8_t)c);
+}
+
+/**
+ * \brief Queue a string from RAM
+ *
+ * \param[in] s Zero-terminated string
+ */
+void FMT_PutString(const char *s)
+{
+	while (*s) {
+		USART1_Write((uint8_t)*s++);
+	}
+}
+
+/**
+ * \brief Queue a string from flash, see FMT_PUTS()
+ *
+ * \param[in] s Zero-terminated string in program memory
+ */
+void FMT_PutString_P(const char *s)
+{
+	char c;
+
+	while ((c = pgm_read_byte(s++)) != '\0') {
+		USART1_Write((uint8_t)c);
+	}
+}
+
+/**
+ * \brief Queue an unsigned decimal number
+ *
+ * \param[in] value Number
+ */
+void FMT_PutUnsigned(uint32_t value)
+{
+	char buf[FMT_DECIMAL_MAX];
+
+	FMT_Write(buf, FMT_Decimal(buf, value, 0));
+}
+
+/**
+ * \brief Queue a signed decimal number
+ *
+ * \param[in] value Number
+ */
+void FMT_PutSigned(int32_t value)
+{
+	FMT_PutFixed(value, 0);
+}
+
+/**
+ * \brief Queue a fixed-point number
+ *
+ * FMT_PutFixed(-1234, 2) queues "-12.34", FMT_PutFixed(5, 3) "0.005".
+ *
+ * \param[in] value Number scaled by 10^decimals
+ * \param[in] decimals Digits after the decimal point, 0 to 9
+ */
+void FMT_PutFixed(int32_t value, uint8_t decimals)
+{
+	char     buf[FMT_DECIMAL_MAX];
+	uint8_t  n         = 0;
+	uint32_t magnitude = (uint32_t)value;
+
+	if (value < 0) {
+		buf[n++]  = '-';
+		magnitude = -magnitude;
+	}
+
+	n += FMT_Decimal(&buf[n], magnitude, decimals);
+	FMT_Write(buf, n);
+}
+
+/**
+ * \brief Queue a hexadecimal number with a fixed number of digits
+ *
+ * \param[in] value Number, higher digits than requested are not shown
+ * \param[in] digits Number of digits, clamped to 1 to 8
+ */
+void FMT_PutHex(uint32_t value, uint8_t digits)
+{
+	char buf[8];
+
+	if (digits == 0) {
+		digits = 1;
+	} else if (digits > sizeof(buf)) {
+		digits = sizeof(buf);
+	}
+
+	for (uint8_t i = digits; i > 0; i--) {
+		buf[i - 1] = pgm_read_byte(&fmt_hex[value & 0x0F]);
+		value >>= 4;
+	}
+
+	FMT_Write(buf, digits);
+}
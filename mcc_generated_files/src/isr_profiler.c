@@ -0,0 +1,181 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#include "../include/utils/compiler.h"
+
+#if ISR_PROFILER_ENABLE
+
+#include "../include/isr_profiler.h"
+#include "../include/utils/atomic.h"
+
+static isr_profile_t isr_profiler_slots[ISR_PROFILER_SLOTS];
+
+static volatile uint16_t isr_profiler_max_latency;
+
+/**
+ * \brief Start TCB1 as free-running timestamp counter and latency probe
+ *
+ * \return Nothing
+ */
+void ISR_PROFILER_Initialize(void)
+{
+	TCB1.CTRLA    = 0;
+	TCB1.CTRLB    = TCB_CNTMODE_INT_gc;
+	TCB1.CNT      = 0;
+	TCB1.CCMP     = 0xFFFF;
+	TCB1.INTFLAGS = TCB_CAPT_bm;
+	TCB1.INTCTRL  = TCB_CAPT_bm;
+
+	//CLKSEL DIV1; ENABLE enabled;
+	TCB1.CTRLA = TCB_CLKSEL_DIV1_gc | TCB_ENABLE_bm;
+}
+
+/**
+ * \brief Latency probe, the counter restarted at 0 when the interrupt was raised
+ */
+ISR_UNPROFILED(TCB1_INT_vect)
+{
+	uint16_t latency = TCB1.CNT;
+
+	TCB1.INTFLAGS = TCB_CAPT_bm;
+
+	if (latency > isr_profiler_max_latency) {
+		isr_profiler_max_latency = latency;
+	}
+}
+
+/**
+ * \brief Add one duration to the profile of a vector
+ *
+ * Called from the ISR() wrapper with interrupts of the same level disabled.
+ *
+ * \param[in,out] slot Slot cache of the calling handler, assigned on first use
+ * \param[in] vector_num Vector number of the handler
+ * \param[in] duration Cycles spent in the handler
+ */
+void ISR_PROFILER_Record(isr_profile_t **slot, uint8_t vector_num, uint16_t duration)
+{
+	isr_profile_t *profile = *slot;
+
+	if (profile == NULL) {
+		for (uint8_t i = 0; i < ISR_PROFILER_SLOTS; i++) {
+			if (isr_profiler_slots[i].vector == 0) {
+				profile         = &isr_profiler_slots[i];
+				profile->vector = vector_num;
+				profile->min    = 0xFFFF;
+				*slot           = profile;
+				break;
+			}
+		}
+		if (profile == NULL) {
+			/* Table full, the vector is not profiled */
+			return;
+		}
+	}
+
+	profile->count++;
+	profile->total += duration;
+	if (duration < profile->min) {
+		profile->min = duration;
+	}
+	if (duration > profile->max) {
+		profile->max = duration;
+	}
+}
+
+/**
+ * \brief Copy one slot of the table
+ *
+ * \param[in] index Slot index, 0 to ISR_PROFILER_SLOTS - 1
+ * \param[out] profile Copy of the slot, taken with interrupts disabled
+ *
+ * \return false if the slot is unused
+ */
+bool ISR_PROFILER_Read(uint8_t index, isr_profile_t *profile)
+{
+	if (index >= ISR_PROFILER_SLOTS) {
+		return false;
+	}
+
+	ENTER_CRITICAL(R);
+	*profile = isr_profiler_slots[index];
+	EXIT_CRITICAL(R);
+
+	return profile->vector != 0;
+}
+
+/**
+ * \brief Longest wait of the latency probe
+ *
+ * \return Cycles from the probe interrupt being raised to its handler reading TCB1.CNT
+ */
+uint16_t ISR_PROFILER_GetMaxLatency(void)
+{
+	uint16_t latency;
+
+	ENTER_CRITICAL(R);
+	latency = isr_profiler_max_latency;
+	EXIT_CRITICAL(R);
+
+	return latency;
+}
+
+/**
+ * \brief Clear the statistics, slot assignments are kept
+ *
+ * \return Nothing
+ */
+void ISR_PROFILER_Reset(void)
+{
+	ENTER_CRITICAL(R);
+	for (uint8_t i = 0; i < ISR_PROFILER_SLOTS; i++) {
+		isr_profiler_slots[i].count = 0;
+		isr_profiler_slots[i].min   = 0xFFFF;
+		isr_profiler_slots[i].max   = 0;
+		isr_profiler_slots[i].total = 0;
+	}
+	isr_profiler_max_latency = 0;
+	EXIT_CRITICAL(R);
+}
+
+#endif
@@ -48,14 +48,23 @@ Copyright (c) [2012-2020] Microchip Technology Inc.
  * Initializes MCU, drivers and middleware in the project
 **/
 
-int8_t CLKCTRL_Initialize();
-
 void SYSTEM_Initialize(void)
 {
     PIN_MANAGER_Initialize();
     FLASH_Initialize();
+    CONFIG_STORE_Initialize();
+    EVENT_LOG_Initialize();
     CPUINT_Initialize();
     CLKCTRL_Initialize();
+    TIMEBASE_Initialize();
+    POWER_Initialize();
+    USART1_Initialize();
+#if WATCHDOG_ENABLE
+    WATCHDOG_Initialize();
+#endif
+#if ISR_PROFILER_ENABLE
+    ISR_PROFILER_Initialize();
+#endif
 }
 
 /**
@@ -64,31 +73,31 @@ void SYSTEM_Initialize(void)
 int8_t CLKCTRL_Initialize()
 {
     //CLKOUT disabled; CLKSEL Internal high-frequency oscillator; 
-    ccp_write_io((void*)&(CLKCTRL.MCLKCTRLA),0x0);
+    CCP_WRITE_IO(CLKCTRL.MCLKCTRLA,0x0);
     
     //PDIV 2X; PEN disabled; 
-    ccp_write_io((void*)&(CLKCTRL.MCLKCTRLB),0x0);
+    CCP_WRITE_IO(CLKCTRL.MCLKCTRLB,0x0);
     
     //LOCKEN disabled; 
-    ccp_write_io((void*)&(CLKCTRL.MCLKLOCK),0x0);
+    CCP_WRITE_IO(CLKCTRL.MCLKLOCK,0x0);
     
     //PLLS disabled; EXTS disabled; XOSC32KS disabled; OSC32KS disabled; OSCHFS disabled; SOSC disabled; 
-    ccp_write_io((void*)&(CLKCTRL.MCLKSTATUS),0x0);
+    CCP_WRITE_IO(CLKCTRL.MCLKSTATUS,0x0);
     
     //RUNSTDBY disabled; FREQSEL 4 MHz system clock (default); AUTOTUNE disabled; 
-    ccp_write_io((void*)&(CLKCTRL.OSCHFCTRLA),0xC);
+    CCP_WRITE_IO(CLKCTRL.OSCHFCTRLA,0xC);
     
     //TUNE 0x0; 
-    ccp_write_io((void*)&(CLKCTRL.OSCHFTUNE),0x0);
+    CCP_WRITE_IO(CLKCTRL.OSCHFTUNE,0x0);
     
     //RUNSTDBY disabled; 
-    ccp_write_io((void*)&(CLKCTRL.OSC32KCTRLA),0x0);
+    CCP_WRITE_IO(CLKCTRL.OSC32KCTRLA,0x0);
     
     //RUNSTDBY disabled; SOURCE disabled; MULFAC PLL is disabled; 
-    ccp_write_io((void*)&(CLKCTRL.PLLCTRLA),0x0);
+    CCP_WRITE_IO(CLKCTRL.PLLCTRLA,0x0);
     
     //RUNSTDBY disabled; CSUT 1k cycles; SEL disabled; LPMODE disabled; ENABLE disabled; 
-    ccp_write_io((void*)&(CLKCTRL.XOSC32KCTRLA),0x0);
+    CCP_WRITE_IO(CLKCTRL.XOSC32KCTRLA,0x0);
     
 
     return 0;
@@ -41,8 +41,23 @@ Copyright (c) [2012-2020] Microchip Technology Inc.
     such restrictions will not apply to such third party software.
 */
 
+#define ASSERT_FILE_ID ASSERT_FILE_NVMCTRL
+
 #include "../include/nvmctrl.h"
+#include "../include/utils/atomic.h"
+#include "../include/utils/utils_assert.h"
 #include <avr/pgmspace.h>
+#include <avr/sleep.h>
+
+/** Page marker of a writer context that has not erased any page yet */
+#define FLASH_WRITER_NO_PAGE ((flash_adr_t)-1)
+
+/* Page start is found by masking, the writer cursor wraps EEPROM addresses to 16 bits */
+STATIC_ASSERT_POWER_OF_TWO(PROGMEM_PAGE_SIZE, flash_page_size_not_power_of_two);
+STATIC_ASSERT(EEPROM_SIZE <= 0x10000UL, eeprom_address_too_wide);
+
+static nvmctrl_wait_mode_t nvm_wait_mode = NVM_WAIT_POLL;
+static nvmctrl_yield_t     nvm_yield;
 
 /**
  * \brief Initialize nvmctrl interface
@@ -61,11 +76,83 @@ int8_t FLASH_Initialize(void)
 
 ISR(NVMCTRL_EE_vect)
 {
+    /* EEREADY stays set while NVMCTRL is idle, so the interrupt is one-shot */
+    NVMCTRL.INTCTRL = 0;
 
     /* The interrupt flag has to be cleared manually */
     NVMCTRL.INTFLAGS = NVMCTRL_EEREADY_bm;
 }
 
+/**
+ * \brief Select how NVMCTRL routines wait for the controller
+ *
+ * NVM_WAIT_YIELD calls the yield function for as long as the controller is
+ * busy, so a scheduler can run other work during an erase or write. The yield
+ * function must not start NVM operations itself.
+ *
+ * NVM_WAIT_SLEEP enters idle sleep until the EEREADY interrupt when only the
+ * EEPROM is busy and global interrupts are enabled. EEREADY does not report
+ * flash completion, and a flash erase or write halts the CPU anyway while it
+ * executes from the section being programmed, so flash waits keep polling.
+ *
+ * \param[in] mode NVM_WAIT_POLL, NVM_WAIT_YIELD or NVM_WAIT_SLEEP
+ * \param[in] yield Function called while waiting in NVM_WAIT_YIELD mode
+ *
+ * \return Nothing
+ */
+void FLASH_SetWaitStrategy(nvmctrl_wait_mode_t mode, nvmctrl_yield_t yield)
+{
+	nvm_yield     = yield;
+	nvm_wait_mode = mode;
+}
+
+/**
+ * \brief Idle sleep until the EEREADY interrupt fires
+ *
+ * The busy check and the sleep instruction are separated by sei only, and
+ * the instruction following sei is always executed before an interrupt is
+ * served, so an EEREADY that fires after the check still wakes the CPU.
+ *
+ * \return Nothing
+ */
+static void FLASH_SleepUntilReady(void)
+{
+	uint8_t sreg = SREG;
+
+	/* Nothing could wake us up with interrupts disabled */
+	if (!(sreg & CPU_I_bm)) {
+		return;
+	}
+
+	cli();
+	if ((NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm|NVMCTRL_FBUSY_bm)) == NVMCTRL_EEBUSY_bm) {
+		NVMCTRL.INTCTRL = NVMCTRL_EEREADY_bm;
+		SLPCTRL.CTRLA   = SLPCTRL_SMODE_IDLE_gc | SLPCTRL_SEN_bm;
+		sei();
+		sleep_cpu();
+		SLPCTRL.CTRLA = SLPCTRL_SMODE_IDLE_gc;
+	}
+	SREG = sreg;
+}
+
+/**
+ * \brief Wait until NVMCTRL can accept a new command
+ *
+ * Uses the strategy selected with FLASH_SetWaitStrategy().
+ *
+ * \return Nothing
+ */
+void FLASH_WaitReady(void)
+{
+	while (NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm|NVMCTRL_FBUSY_bm)) {
+		if ((nvm_wait_mode == NVM_WAIT_YIELD) && (nvm_yield != NULL)) {
+			nvm_yield();
+		} else if (nvm_wait_mode == NVM_WAIT_SLEEP) {
+			FLASH_SleepUntilReady();
+		}
+	}
+}
+
 /**
  * \brief Read a byte from eeprom
  *
@@ -91,16 +178,16 @@ uint8_t FLASH_ReadEepromByte(eeprom_adr_t eeprom_adr)
 nvmctrl_status_t FLASH_WriteEepromByte(eeprom_adr_t eeprom_adr, uint8_t data)
 {
 		/* Wait for completion of previous write */
-		while (NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm|NVMCTRL_FBUSY_bm));
+		FLASH_WaitReady();
 
 		/* Program the EEPROM with desired value(s) */
-		ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_EEERWR_gc);
+		CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_EEERWR_gc);
 
 		/* Write byte to EEPROM */
 		*(uint8_t *)(EEPROM_START + eeprom_adr) = data;
 		
 		/* Clear the current command */
-		ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc); 
+		CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc); 
 
 		return NVM_OK;		
 }
@@ -133,9 +220,9 @@ nvmctrl_status_t FLASH_WriteEepromBlock(eeprom_adr_t eeprom_adr, uint8_t *data,
 		uint8_t *write = (uint8_t *)(EEPROM_START + eeprom_adr);
 
 		/* Wait for completion of previous write */
-		while (NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm|NVMCTRL_FBUSY_bm));
+		FLASH_WaitReady();
 		/* Program the EEPROM with desired value(s) */
-		ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_EEERWR_gc);
+		CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_EEERWR_gc);
 
 		do {
 			/* Write byte to EEPROM */
@@ -144,7 +231,7 @@ nvmctrl_status_t FLASH_WriteEepromBlock(eeprom_adr_t eeprom_adr, uint8_t *data,
 		} while (size != 0);
 
 		/* Clear the current command */
-		ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+		CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
 
 		return NVM_OK;
 }
@@ -222,28 +309,28 @@ nvmctrl_status_t FLASH_WriteFlashByte(flash_adr_t flash_adr, uint8_t *ram_buffer
 	}
 
 	/* Wait for completion of previous operation */
-	while (NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm|NVMCTRL_FBUSY_bm));
+	FLASH_WaitReady();
 
 	/* Erase the flash page */
-	ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_FLPER_gc);
+	CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_FLPER_gc);
 	/* dummy write to start erase operation */
 	FLASH_SpmWriteWord(start_of_page,0);
 
 	/* Wait for completion of previous operation */
-	while (NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm|NVMCTRL_FBUSY_bm));
+	FLASH_WaitReady();
 
 	/*A change from one command to another must always go through NOCMD or NOOP*/
-	ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+	CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
 
 	/* Program the page with desired value(s) */
-	ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_FLWR_gc);
+	CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_FLWR_gc);
 
 	/* write the modified page data to FLASH*/
 	for (i = 0; i < PROGMEM_PAGE_SIZE/2; i++) {	
 		FLASH_SpmWriteWord(start_of_page+(i*2),word_buffer[i]);
 	}
 	/* Clear the current command */
-	ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+	CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
 
 	if (NVMCTRL.STATUS & NVMCTRL_ERROR_gm)
 		return NVM_ERROR;
@@ -261,16 +348,16 @@ nvmctrl_status_t FLASH_WriteFlashByte(flash_adr_t flash_adr, uint8_t *ram_buffer
 nvmctrl_status_t FLASH_EraseFlashPage(flash_adr_t flash_adr)
 {
 	/* Wait for completion of previous operation */
-	while (NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm|NVMCTRL_FBUSY_bm));
+	FLASH_WaitReady();
 
 	/* Erase the flash page */
-	ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_FLPER_gc);
+	CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_FLPER_gc);
 
 	/* dummy write to start erase operation */
 	FLASH_SpmWriteWord(flash_adr,0);
 
 	/* Clear the current command */
-	ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+	CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
 
 	if (NVMCTRL.STATUS & NVMCTRL_ERROR_gm)
 		return NVM_ERROR;
@@ -278,6 +365,40 @@ nvmctrl_status_t FLASH_EraseFlashPage(flash_adr_t flash_adr)
 		return NVM_OK;
 }
 
+/**
+ * \brief Start erasing a page in flash without waiting for the controller
+ *
+ * The erase is only started if NVMCTRL is idle, checked and issued with
+ * interrupts disabled like a writer push. It completes in the background,
+ * the next operation waits for it.
+ *
+ * \param[in] flash_adr The byte-address in flash to erase. Must point to start-of-page.
+ *
+ * \return NVM_BUSY if the controller is busy and the erase was not started
+ */
+nvmctrl_status_t FLASH_StartEraseFlashPage(flash_adr_t flash_adr)
+{
+	nvmctrl_status_t status = NVM_OK;
+
+	ENTER_CRITICAL(W);
+
+	if (NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm|NVMCTRL_FBUSY_bm)) {
+		status = NVM_BUSY;
+	} else {
+		CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_FLPER_gc);
+		FLASH_SpmWriteWord(flash_adr, 0);
+		CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+
+		if (NVMCTRL.STATUS & NVMCTRL_ERROR_gm) {
+			status = NVM_ERROR;
+		}
+	}
+
+	EXIT_CRITICAL(W);
+
+	return status;
+}
+
 
 /**
  * \brief Write a page in flash. No page erase is performed by this function.
@@ -297,24 +418,22 @@ nvmctrl_status_t FLASH_WriteFlashPage(flash_adr_t flash_adr, uint8_t *data)
 	}
 
 	/* Wait for completion of previous operation */
-	while (NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm|NVMCTRL_FBUSY_bm))
-		;
+	FLASH_WaitReady();
 
 	/* Erase the flash page */
-	ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_FLPER_gc);
+	CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_FLPER_gc);
 
 	/* Perform a dummy write to this address to update the address register in NVMCTL */
 	FLASH_SpmWriteWord(flash_adr,0);
 
 	/* Wait for completion of previous operation */
-	while (NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm|NVMCTRL_FBUSY_bm))
-		;
+	FLASH_WaitReady();
 
 	/*A change from one command to another must always go through NOCMD or NOOP*/
-	ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+	CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
 
 	/* Write the flash page */
-	ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_FLWR_gc);
+	CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_FLWR_gc);
 
 	/* Write data to the page buffer */
 	for (uint16_t i = 0; i < PROGMEM_PAGE_SIZE/2; i++) {
@@ -322,7 +441,7 @@ nvmctrl_status_t FLASH_WriteFlashPage(flash_adr_t flash_adr, uint8_t *data)
 	}	
 
 	/* Clear the current command */
-	ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+	CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
 
 	if (NVMCTRL.STATUS & NVMCTRL_ERROR_gm)
 		return NVM_ERROR;
@@ -409,6 +528,11 @@ nvmctrl_status_t FLASH_WriteFlashBlock(flash_adr_t flash_adr, uint8_t *data, siz
  * performance needs and code size concerns leaves the byte write and block
  * write functions too expensive.
  *
+ * Only one stream can be in flight through this function. Producers that
+ * need their own streams should open a writer context with FLASH_WriterOpen().
+ * An address below the start of the stream restarts it on the page holding
+ * that address, which is erased before the byte is written.
+ *
  * \param[in] flash_adr The byte-address of the flash to write to
  * \param[in] data The data byte to write to the flash
  * \param[in] finalize Set to true for the final write to the buffer
@@ -417,52 +541,226 @@ nvmctrl_status_t FLASH_WriteFlashBlock(flash_adr_t flash_adr, uint8_t *data, siz
  */
 nvmctrl_status_t FLASH_WriteFlashStream(flash_adr_t flash_adr, uint8_t data, bool finalize)
 {
-	static bool first_byte = true;
-	uint16_t word_data;
-	
-	if (first_byte) {
+	static nvmctrl_writer_t stream;
+	nvmctrl_status_t status;
+
+	if (flash_adr >= PROGMEM_SIZE) {
+		return NVM_ERROR;
+	}
+
+	if (stream.state != NVM_WRITER_OPEN) {
 		/* check for the starting of page */
-		if ( flash_adr % PROGMEM_PAGE_SIZE != 0) {
+		if (flash_adr % PROGMEM_PAGE_SIZE != 0) {
 			return NVM_ERROR;
 		}
-		first_byte = false;
+		FLASH_WriterOpen(&stream, NVM_TARGET_FLASH, flash_adr, PROGMEM_SIZE - flash_adr);
+	} else if (flash_adr < stream.start) {
+		/* Moving backwards: restart the stream on the page of the new address */
+		flash_adr_t page = flash_adr & ~((flash_adr_t)PROGMEM_PAGE_SIZE - 1);
+
+		FLASH_WriterOpen(&stream, NVM_TARGET_FLASH, page, PROGMEM_SIZE - page);
 	}
-	/* check for a new page */
-	if (flash_adr % PROGMEM_PAGE_SIZE == 0) {
-		/* Erase the flash page and program with desired value(s) */
-		/* Wait for completion of previous operation */
-		while (NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm|NVMCTRL_FBUSY_bm))
-			;
-
-		/* Erase the flash page */
-		ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_FLPER_gc);
-		/* dummy write to start erase operation */
-		FLASH_SpmWriteWord(flash_adr,0);
-
-		/* Wait for completion of previous operation */
-		while (NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm|NVMCTRL_FBUSY_bm))
-			;
-
-		/* Program the page with desired value(s) */
-		ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_FLWR_gc);
+
+	/* The caller supplies the address of every byte */
+	stream.cursor = flash_adr;
+	status = FLASH_WriterPush(&stream, data);
+
+	if (finalize || status == NVM_ERROR) {
+		if (FLASH_WriterFlush(&stream) == NVM_ERROR) {
+			status = NVM_ERROR;
+		}
 	}
-	
-	if ( flash_adr %2)
-		word_data = data << 8 | 0xFF;
-	else
-		word_data = 0xFF << 8 | data;
-		
-	// Write the new word value to the correct address. Making the flash_adr word aligned
-	FLASH_SpmWriteWord(flash_adr & ~(flash_adr_t)1,word_data);
 
-	if (finalize) {
-		/* Clear the current command */
-		ccp_write_spm((void *)&NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
-		first_byte = true;
+	return status;
+}
+
+/**
+ * \brief Open a writer context on a range of flash or EEPROM
+ *
+ * A flash range starting on a page boundary has each page erased when the
+ * first byte is pushed into it. A flash range starting inside a page is
+ * assumed to continue an already erased page, so appending to a partially
+ * written page does not erase the bytes in front of the cursor.
+ *
+ * \param[in] writer The context to initialize
+ * \param[in] target NVM_TARGET_FLASH or NVM_TARGET_EEPROM
+ * \param[in] start The byte-address of the first byte to write. For EEPROM this is the offset from EEPROM_START
+ * \param[in] size The number of bytes the context may write
+ *
+ * \return Status of the operation
+ */
+nvmctrl_status_t FLASH_WriterOpen(nvmctrl_writer_t *writer, nvmctrl_target_t target, flash_adr_t start, flash_adr_t size)
+{
+	flash_adr_t limit = (target == NVM_TARGET_EEPROM) ? EEPROM_SIZE : PROGMEM_SIZE;
+
+	writer->state = NVM_WRITER_IDLE;
+
+	if ((size == 0) || (start >= limit) || (size > limit - start)) {
+		return NVM_ERROR;
 	}
 
-	if (NVMCTRL.STATUS & NVMCTRL_ERROR_gm)
+	writer->target = target;
+	writer->error  = NVM_OK;
+	writer->start  = start;
+	writer->end    = start + size;
+	writer->cursor = start;
+
+	if ((target == NVM_TARGET_FLASH) && (start % PROGMEM_PAGE_SIZE != 0)) {
+		writer->page = start & ~((flash_adr_t)PROGMEM_PAGE_SIZE - 1);
+	} else {
+		writer->page = FLASH_WRITER_NO_PAGE;
+	}
+
+	writer->state = NVM_WRITER_OPEN;
+
+	return NVM_OK;
+}
+
+/**
+ * \brief Try to program the byte at the writer cursor
+ *
+ * Checking that NVMCTRL is idle and issuing the command is done with
+ * interrupts disabled, which is what arbitrates between writers: whoever
+ * finds the controller idle owns it for one command, everybody else gets
+ * NVM_BUSY and retries after the operation in flight has completed.
+ *
+ * \param[in] writer The context to push through
+ * \param[in] data The byte to write
+ *
+ * \return NVM_BUSY if the byte was not consumed and the push must be retried
+ */
+static nvmctrl_status_t FLASH_WriterTryPush(nvmctrl_writer_t *writer, uint8_t data)
+{
+	flash_adr_t      adr      = writer->cursor;
+	flash_adr_t      page     = adr & ~((flash_adr_t)PROGMEM_PAGE_SIZE - 1);
+	nvmctrl_status_t status   = NVM_OK;
+	bool             consumed = true;
+	uint16_t         word_data;
+
+	RUNTIME_ASSERT(adr >= writer->start && adr < writer->end);
+
+	ENTER_CRITICAL(W);
+
+	if (NVMCTRL.STATUS & (NVMCTRL_EEBUSY_bm|NVMCTRL_FBUSY_bm)) {
+		status   = NVM_BUSY;
+		consumed = false;
+	} else if (writer->target == NVM_TARGET_EEPROM) {
+		/* Program the EEPROM with desired value(s) */
+		CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_EEERWR_gc);
+		*(uint8_t *)(EEPROM_START + (eeprom_adr_t)adr) = data;
+		CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+	} else if (page != writer->page) {
+		/* First byte of a new page: erase it, the byte goes in once the erase is done */
+		CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_FLPER_gc);
+		FLASH_SpmWriteWord(page, 0);
+		CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+		writer->page = page;
+		status       = NVM_BUSY;
+		consumed     = false;
+	} else {
+		if (adr % 2)
+			word_data = data << 8 | 0xFF;
+		else
+			word_data = 0xFF << 8 | data;
+
+		/* Erased bits read as one, so the 0xFF half leaves the neighbour byte unaltered */
+		CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_FLWR_gc);
+		FLASH_SpmWriteWord(adr & ~(flash_adr_t)1, word_data);
+		CCP_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+	}
+
+	if (NVMCTRL.STATUS & NVMCTRL_ERROR_gm) {
+		status = NVM_ERROR;
+	}
+
+	EXIT_CRITICAL(W);
+
+	if (status == NVM_ERROR) {
+		writer->error = NVM_ERROR;
+		writer->state = NVM_WRITER_ERROR;
+	} else if (consumed) {
+		writer->cursor++;
+	}
+
+	return status;
+}
+
+/**
+ * \brief Write the next byte of a writer context
+ *
+ * The byte goes to the writer cursor, which then advances by one. Flash
+ * pages are erased as the cursor enters them. The controller is released
+ * again before this function returns, so a writer that is never flushed
+ * leaves no command pending in NVMCTRL.
+ *
+ * \param[in] writer The context to push through
+ * \param[in] data The byte to write
+ *
+ * \return Status of the operation
+ */
+nvmctrl_status_t FLASH_WriterPush(nvmctrl_writer_t *writer, uint8_t data)
+{
+	nvmctrl_status_t status;
+
+	if (writer->state != NVM_WRITER_OPEN) {
 		return NVM_ERROR;
-	else
-		return NVM_OK;
+	}
+
+	if (writer->cursor >= writer->end) {
+		writer->error = NVM_ERROR;
+		writer->state = NVM_WRITER_ERROR;
+		return NVM_ERROR;
+	}
+
+	while ((status = FLASH_WriterTryPush(writer, data)) == NVM_BUSY) {
+		FLASH_WaitReady();
+	}
+
+	return status;
+}
+
+/**
+ * \brief Complete a writer context
+ *
+ * Waits for the last operation of the writer to finish and closes the
+ * context. Bytes of a flash page that were not pushed remain erased.
+ *
+ * \param[in] writer The context to complete
+ *
+ * \return NVM_ERROR if any push of this context failed, NVM_OK otherwise
+ */
+nvmctrl_status_t FLASH_WriterFlush(nvmctrl_writer_t *writer)
+{
+	nvmctrl_status_t status = writer->error;
+
+	if (writer->state == NVM_WRITER_IDLE) {
+		return NVM_ERROR;
+	}
+
+	/* Wait for completion of previous operation */
+	FLASH_WaitReady();
+
+	if (NVMCTRL.STATUS & NVMCTRL_ERROR_gm) {
+		status = NVM_ERROR;
+	}
+
+	writer->state = NVM_WRITER_IDLE;
+
+	return status;
+}
+
+/**
+ * \brief Close a writer context without waiting for it
+ *
+ * No NVMCTRL command is held between pushes, so nothing needs to be undone
+ * in the controller. An operation already started completes in the
+ * background.
+ *
+ * \param[in] writer The context to close
+ *
+ * \return Nothing
+ */
+void FLASH_WriterAbort(nvmctrl_writer_t *writer)
+{
+	writer->state = NVM_WRITER_IDLE;
 }
@@ -39,114 +39,55 @@
 
 void PORT_Initialize(void);
 
+/** Number of PORT instances on the device */
+#define PIN_MANAGER_PORT_COUNT 7
+
+/** Address distance between two PORT instances */
+#define PIN_MANAGER_PORT_STRIDE ((uint16_t)&PORTB - (uint16_t)&PORTA)
+
+/** PORT instance by index, 0 for PORTA */
+#define PIN_MANAGER_PORT(index) (*(PORT_t *)((uint16_t)&PORTA + (index) * PIN_MANAGER_PORT_STRIDE))
+
+/**
+ * Pins sharing one PINnCTRL setting. The setting is written once to the
+ * PINCONFIG register, which is mirrored in all PORT instances, and then
+ * applied with one PINCTRLUPD write per port that has pins in the group.
+ */
+typedef struct {
+    uint8_t pinctrl;                        ///< PINnCTRL value of the group
+    uint8_t mask[PIN_MANAGER_PORT_COUNT];   ///< Pins taking the value, per port
+} pin_manager_group_t;
+
+/* DIR Registers Initialization, PORTA to PORTG; PC0 USART1 TXD output */
+static const uint8_t pin_manager_dir[PIN_MANAGER_PORT_COUNT] = {0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00};
+
+/* OUT Registers Initialization, PORTA to PORTG */
+static const uint8_t pin_manager_out[PIN_MANAGER_PORT_COUNT] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+/* PINxCTRL registers Initialization, grouped by value */
+static const pin_manager_group_t pin_manager_groups[] = {
+    //PULLUPEN disabled; INVEN disabled; ISC interrupt disabled and input buffer enabled; all pins
+    {0x00, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}},
+};
+
 void PIN_MANAGER_Initialize()
 {
   PORT_Initialize();
-  /* DIR Registers Initialization */
-    PORTA.DIR = 0x00;
-    PORTB.DIR = 0x00;
-    PORTC.DIR = 0x00;
-    PORTD.DIR = 0x00;
-    PORTE.DIR = 0x00;
-    PORTF.DIR = 0x00;
-    PORTG.DIR = 0x00;
-
-  /* OUT Registers Initialization */
-    PORTA.OUT = 0x00;
-    PORTB.OUT = 0x00;
-    PORTC.OUT = 0x00;
-    PORTD.OUT = 0x00;
-    PORTE.OUT = 0x00;
-    PORTF.OUT = 0x00;
-    PORTG.OUT = 0x00;
+  /* OUT before DIR, so pins turning into outputs start at their final level */
+    for (uint8_t i = 0; i < PIN_MANAGER_PORT_COUNT; i++) {
+      PIN_MANAGER_PORT(i).OUT = pin_manager_out[i];
+      PIN_MANAGER_PORT(i).DIR = pin_manager_dir[i];
+    }
 
   /* PINxCTRL registers Initialization */
-    PORTA.PIN0CTRL = 0x00;
-    PORTA.PIN1CTRL = 0x00;
-    PORTA.PIN2CTRL = 0x00;
-    PORTA.PIN3CTRL = 0x00;
-    PORTA.PIN4CTRL = 0x00;
-    PORTA.PIN5CTRL = 0x00;
-    PORTA.PIN6CTRL = 0x00;
-    PORTA.PIN7CTRL = 0x00;
-    PORTB.PIN0CTRL = 0x00;
-    PORTB.PIN1CTRL = 0x00;
-    PORTB.PIN2CTRL = 0x00;
-    PORTB.PIN3CTRL = 0x00;
-    PORTB.PIN4CTRL = 0x00;
-    PORTB.PIN5CTRL = 0x00;
-    PORTB.PIN6CTRL = 0x00;
-    PORTB.PIN7CTRL = 0x00;
-    PORTC.PIN0CTRL = 0x00;
-    PORTC.PIN1CTRL = 0x00;
-    PORTC.PIN2CTRL = 0x00;
-    PORTC.PIN3CTRL = 0x00;
-    PORTC.PIN4CTRL = 0x00;
-    PORTC.PIN5CTRL = 0x00;
-    PORTC.PIN6CTRL = 0x00;
-    PORTC.PIN7CTRL = 0x00;
-    PORTD.PIN0CTRL = 0x00;
-    PORTD.PIN1CTRL = 0x00;
-    PORTD.PIN2CTRL = 0x00;
-    PORTD.PIN3CTRL = 0x00;
-    PORTD.PIN4CTRL = 0x00;
-    PORTD.PIN5CTRL = 0x00;
-    PORTD.PIN6CTRL = 0x00;
-    PORTD.PIN7CTRL = 0x00;
-    PORTE.PIN0CTRL = 0x00;
-    PORTE.PIN1CTRL = 0x00;
-    PORTE.PIN2CTRL = 0x00;
-    PORTE.PIN3CTRL = 0x00;
-    PORTE.PIN4CTRL = 0x00;
-    PORTE.PIN5CTRL = 0x00;
-    PORTE.PIN6CTRL = 0x00;
-    PORTE.PIN7CTRL = 0x00;
-    PORTF.PIN0CTRL = 0x00;
-    PORTF.PIN1CTRL = 0x00;
-    PORTF.PIN2CTRL = 0x00;
-    PORTF.PIN3CTRL = 0x00;
-    PORTF.PIN4CTRL = 0x00;
-    PORTF.PIN5CTRL = 0x00;
-    PORTF.PIN6CTRL = 0x00;
-    PORTF.PIN7CTRL = 0x00;
-    PORTG.PIN0CTRL = 0x00;
-    PORTG.PIN1CTRL = 0x00;
-    PORTG.PIN2CTRL = 0x00;
-    PORTG.PIN3CTRL = 0x00;
-    PORTG.PIN4CTRL = 0x00;
-    PORTG.PIN5CTRL = 0x00;
-    PORTG.PIN6CTRL = 0x00;
-    PORTG.PIN7CTRL = 0x00;
-
-  /* Multi-pin Config registers Initialization */
-    PORTA.PINCONFIG = 0x00;
-    PORTA.PINCTRLCLR = 0x00;
-    PORTA.PINCTRLSET = 0x00;
-    PORTA.PINCTRLUPD = 0x00;
-    PORTB.PINCONFIG = 0x00;
-    PORTB.PINCTRLCLR = 0x00;
-    PORTB.PINCTRLSET = 0x00;
-    PORTB.PINCTRLUPD = 0x00;
-    PORTC.PINCONFIG = 0x00;
-    PORTC.PINCTRLCLR = 0x00;
-    PORTC.PINCTRLSET = 0x00;
-    PORTC.PINCTRLUPD = 0x00;
-    PORTD.PINCONFIG = 0x00;
-    PORTD.PINCTRLCLR = 0x00;
-    PORTD.PINCTRLSET = 0x00;
-    PORTD.PINCTRLUPD = 0x00;
-    PORTE.PINCONFIG = 0x00;
-    PORTE.PINCTRLCLR = 0x00;
-    PORTE.PINCTRLSET = 0x00;
-    PORTE.PINCTRLUPD = 0x00;
-    PORTF.PINCONFIG = 0x00;
-    PORTF.PINCTRLCLR = 0x00;
-    PORTF.PINCTRLSET = 0x00;
-    PORTF.PINCTRLUPD = 0x00;
-    PORTG.PINCONFIG = 0x00;
-    PORTG.PINCTRLCLR = 0x00;
-    PORTG.PINCTRLSET = 0x00;
-    PORTG.PINCTRLUPD = 0x00;
+    for (uint8_t g = 0; g < sizeof(pin_manager_groups) / sizeof(pin_manager_groups[0]); g++) {
+      PORTA.PINCONFIG = pin_manager_groups[g].pinctrl;
+      for (uint8_t i = 0; i < PIN_MANAGER_PORT_COUNT; i++) {
+        if (pin_manager_groups[g].mask[i]) {
+          PIN_MANAGER_PORT(i).PINCTRLUPD = pin_manager_groups[g].mask[i];
+        }
+      }
+    }
 
   /* PORTMUX Initialization */
     PORTMUX.ACROUTEA = 0x0;
@@ -170,35 +111,11 @@ void PORT_Initialize(void)
   * disables all peripherals to save power. Driver shall enable
   * peripheral if used */
 
-  /* Set all pins to low power mode */
-    for (uint8_t i = 0; i < 8; i++) {
-      *((uint8_t *)&PORTA + 0x10 + i) |= 1 << PORT_PULLUPEN_bp;
-    }
-    
-    for (uint8_t i = 0; i < 8; i++) {
-      *((uint8_t *)&PORTB + 0x10 + i) |= 1 << PORT_PULLUPEN_bp;
+  /* Set all pins to low power mode, PINCTRLSET ORs PINCONFIG into PINnCTRL of the selected pins */
+    PORTA.PINCONFIG = PORT_PULLUPEN_bm;
+    for (uint8_t i = 0; i < PIN_MANAGER_PORT_COUNT; i++) {
+      PIN_MANAGER_PORT(i).PINCTRLSET = 0xFF;
     }
-    
-    for (uint8_t i = 0; i < 8; i++) {
-      *((uint8_t *)&PORTC + 0x10 + i) |= 1 << PORT_PULLUPEN_bp;
-    }
-    
-    for (uint8_t i = 0; i < 8; i++) {
-      *((uint8_t *)&PORTD + 0x10 + i) |= 1 << PORT_PULLUPEN_bp;
-    }
-    
-    for (uint8_t i = 0; i < 8; i++) {
-      *((uint8_t *)&PORTE + 0x10 + i) |= 1 << PORT_PULLUPEN_bp;
-    }
-    
-    for (uint8_t i = 0; i < 8; i++) {
-      *((uint8_t *)&PORTF + 0x10 + i) |= 1 << PORT_PULLUPEN_bp;
-    }
-    
-    for (uint8_t i = 0; i < 8; i++) {
-      *((uint8_t *)&PORTG + 0x10 + i) |= 1 << PORT_PULLUPEN_bp;
-    }
-    
 }
 
 
@@ -0,0 +1,111 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#include "../include/port_interrupt.h"
+#include <avr/interrupt.h>
+
+#if PORTA_DISPATCH_ENABLE || PORTB_DISPATCH_ENABLE || PORTC_DISPATCH_ENABLE || PORTD_DISPATCH_ENABLE               \
+    || PORTE_DISPATCH_ENABLE || PORTF_DISPATCH_ENABLE || PORTG_DISPATCH_ENABLE
+
+/** Index of the lowest set bit of a non-zero nibble */
+static const uint8_t port_interrupt_lowest_bit[16] PROGMEM = {0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0};
+
+/**
+ * \brief Call the callbacks of the set bits in flags, lowest bit first
+ *
+ * \param[in] table Callback table of the port, in flash
+ * \param[in] flags Interrupt flags read from the port
+ */
+static inline void PORT_Dispatch(const port_interrupt_callback_t *table, uint8_t flags)
+{
+	port_interrupt_callback_t callback;
+	uint8_t                   bit;
+
+	while (flags) {
+		if (flags & 0x0F) {
+			bit = pgm_read_byte(&port_interrupt_lowest_bit[flags & 0x0F]);
+		} else {
+			bit = 4 + pgm_read_byte(&port_interrupt_lowest_bit[flags >> 4]);
+		}
+		flags &= flags - 1;
+
+		callback = (port_interrupt_callback_t)pgm_read_word(&table[bit]);
+		if (callback) {
+			callback();
+		}
+	}
+}
+
+/** Handler reading and clearing the flags once, then dispatching them */
+#define PORT_DISPATCH_ISR(letter)                                                                                  \
+	extern const port_interrupt_callback_t port_dispatch_table_##letter[8] PROGMEM;                                  \
+	ISR(PORT##letter##_PORT_vect)                                                                                    \
+	{                                                                                                                \
+		uint8_t flags = VPORT##letter.INTFLAGS;                                                                      \
+		VPORT##letter.INTFLAGS = flags;                                                                              \
+		PORT_Dispatch(port_dispatch_table_##letter, flags);                                                          \
+	}
+
+#if PORTA_DISPATCH_ENABLE
+PORT_DISPATCH_ISR(A)
+#endif
+#if PORTB_DISPATCH_ENABLE
+PORT_DISPATCH_ISR(B)
+#endif
+#if PORTC_DISPATCH_ENABLE
+PORT_DISPATCH_ISR(C)
+#endif
+#if PORTD_DISPATCH_ENABLE
+PORT_DISPATCH_ISR(D)
+#endif
+#if PORTE_DISPATCH_ENABLE
+PORT_DISPATCH_ISR(E)
+#endif
+#if PORTF_DISPATCH_ENABLE
+PORT_DISPATCH_ISR(F)
+#endif
+#if PORTG_DISPATCH_ENABLE
+PORT_DISPATCH_ISR(G)
+#endif
+
+#endif
@@ -0,0 +1,273 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#define ASSERT_FILE_ID ASSERT_FILE_POWER_MANAGER
+
+#include "../include/power_manager.h"
+#include "../include/clock_manager.h"
+#include "../include/utils/atomic.h"
+#include "../include/utils/utils_assert.h"
+#include <avr/sleep.h>
+#include <string.h>
+
+/** SLPCTRL.CTRLA value by mode, SEN included */
+static const uint8_t power_smode[POWER_MODE_COUNT] = {
+	0,
+	SLPCTRL_SMODE_IDLE_gc | SLPCTRL_SEN_bm,
+	SLPCTRL_SMODE_STDBY_gc | SLPCTRL_SEN_bm,
+	SLPCTRL_SMODE_PDOWN_gc | SLPCTRL_SEN_bm,
+};
+
+/** Start-up time in microseconds by mode */
+static const uint8_t power_wakeup_us[POWER_MODE_COUNT] = {
+	0,
+	POWER_WAKEUP_US_IDLE,
+	POWER_WAKEUP_US_STANDBY,
+	POWER_WAKEUP_US_POWER_DOWN,
+};
+
+/** Lock count by mode */
+static volatile uint8_t power_locks[POWER_MODE_COUNT];
+
+/** Wake-up time in ticks at the current clock, by mode */
+static timebase_t power_wakeup_ticks[POWER_MODE_COUNT];
+
+/** Deepest mode within the latency limit */
+static power_mode_t power_latency_mode = POWER_MODE_POWER_DOWN;
+
+static power_hook_t power_hooks[POWER_HOOK_MAX];
+
+static uint8_t power_hook_count;
+
+static power_stats_t power_stats[POWER_MODE_COUNT];
+
+/**
+ * \brief Convert the wake-up times to ticks, clock manager consumer
+ *
+ * \param[in] frequency New peripheral clock frequency in Hz
+ */
+static void POWER_SetClock(uint32_t frequency)
+{
+	(void)frequency;
+
+	power_wakeup_ticks[POWER_MODE_ACTIVE] = 0;
+	for (uint8_t mode = POWER_MODE_IDLE; mode < POWER_MODE_COUNT; mode++) {
+		power_wakeup_ticks[mode] = TIMEBASE_UsToTicks(power_wakeup_us[mode]) + POWER_WAKEUP_CYCLES;
+	}
+}
+
+/**
+ * \brief Initialize the power manager
+ *
+ * \return Nothing
+ */
+void POWER_Initialize(void)
+{
+	memset((void *)power_locks, 0, sizeof(power_locks));
+	POWER_SetClock(CLOCK_GetFrequency());
+	CLOCK_RegisterConsumer(POWER_SetClock);
+
+	//SMODE Idle; SEN disabled;
+	SLPCTRL.CTRLA = SLPCTRL_SMODE_IDLE_gc;
+}
+
+/**
+ * \brief Forbid a sleep mode and all deeper ones, callable from ISRs
+ *
+ * \param[in] mode Shallowest mode to forbid
+ */
+void POWER_Lock(power_mode_t mode)
+{
+	ENTER_CRITICAL(R);
+	power_locks[mode]++;
+	EXIT_CRITICAL(R);
+}
+
+/**
+ * \brief Release a lock taken with POWER_Lock(), callable from ISRs
+ *
+ * \param[in] mode The mode passed to POWER_Lock()
+ */
+void POWER_Unlock(power_mode_t mode)
+{
+	RUNTIME_ASSERT(mode < POWER_MODE_COUNT);
+
+	ENTER_CRITICAL(R);
+	RUNTIME_ASSERT(power_locks[mode] != 0);
+	power_locks[mode]--;
+	EXIT_CRITICAL(R);
+}
+
+/**
+ * \brief Deepest mode the current locks and the latency limit allow
+ *
+ * \return The mode, POWER_MODE_ACTIVE if sleeping is locked
+ */
+power_mode_t POWER_GetAllowedMode(void)
+{
+	uint8_t mode;
+
+	for (mode = POWER_MODE_IDLE; mode <= power_latency_mode; mode++) {
+		if (power_locks[mode]) {
+			break;
+		}
+	}
+
+	return (power_mode_t)(mode - 1);
+}
+
+/**
+ * \brief Bound the wake-to-work latency
+ *
+ * The limit is compared with the start-up times, POWER_WAKEUP_CYCLES is
+ * the same for every mode.
+ *
+ * \param[in] us Largest acceptable wake-up time in microseconds
+ */
+void POWER_SetLatencyLimit(uint32_t us)
+{
+	uint8_t mode = POWER_MODE_POWER_DOWN;
+
+	while ((mode > POWER_MODE_ACTIVE) && (power_wakeup_us[mode] > us)) {
+		mode--;
+	}
+	power_latency_mode = (power_mode_t)mode;
+}
+
+/**
+ * \brief Register a function called around every sleep
+ *
+ * Hooks run with interrupts disabled before sleeping and enabled after
+ * waking. They can switch off peripheral clocks before a deep mode, or
+ * drive a pin for measuring sleep time with a scope.
+ *
+ * \param[in] hook The function to call
+ *
+ * \return 0 on success, -1 if the table is full
+ */
+int8_t POWER_RegisterHook(power_hook_t hook)
+{
+	if (power_hook_count >= POWER_HOOK_MAX) {
+		return -1;
+	}
+
+	power_hooks[power_hook_count++] = hook;
+
+	return 0;
+}
+
+/**
+ * \brief Sleep in the deepest allowed mode
+ *
+ * Call with interrupts disabled after deciding there is nothing to do,
+ * returns with interrupts enabled after the wake-up interrupt has run.
+ * SEI is directly followed by SLEEP, so an interrupt arriving after the
+ * decision still wakes the device.
+ *
+ * \param[in] budget Ticks until the caller must run again, 0xFFFFFFFF for no deadline
+ *
+ * \return The mode slept in, POWER_MODE_ACTIVE if none was possible
+ */
+power_mode_t POWER_Sleep(timebase_t budget)
+{
+	uint8_t    mode = POWER_GetAllowedMode();
+	timebase_t start;
+
+	while ((mode > POWER_MODE_ACTIVE) && (power_wakeup_ticks[mode] >= budget)) {
+		mode--;
+	}
+
+	if (mode == POWER_MODE_ACTIVE) {
+		power_stats[POWER_MODE_ACTIVE].entries++;
+		cpu_irq_enable();
+		return POWER_MODE_ACTIVE;
+	}
+
+	for (uint8_t i = 0; i < power_hook_count; i++) {
+		power_hooks[i]((power_mode_t)mode, false);
+	}
+
+	start         = TIMEBASE_Now();
+	SLPCTRL.CTRLA = power_smode[mode];
+	cpu_irq_enable();
+	sleep_cpu();
+	SLPCTRL.CTRLA = SLPCTRL_SMODE_IDLE_gc;
+
+	power_stats[mode].entries++;
+	power_stats[mode].ticks += TIMEBASE_ELAPSED(start, TIMEBASE_Now());
+
+	for (uint8_t i = 0; i < power_hook_count; i++) {
+		power_hooks[i]((power_mode_t)mode, true);
+	}
+
+	return (power_mode_t)mode;
+}
+
+/**
+ * \brief Copy the statistics of a mode
+ *
+ * \param[in] mode The mode
+ * \param[out] stats The statistics
+ *
+ * \return false for an invalid mode
+ */
+bool POWER_GetStats(power_mode_t mode, power_stats_t *stats)
+{
+	if (mode >= POWER_MODE_COUNT) {
+		return false;
+	}
+
+	*stats = power_stats[mode];
+
+	return true;
+}
+
+/**
+ * \brief Clear the statistics of all modes
+ *
+ * \return Nothing
+ */
+void POWER_ResetStats(void)
+{
+	memset(power_stats, 0, sizeof(power_stats));
+}
@@ -0,0 +1,243 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#include "../include/scheduler.h"
+#include "../include/power_manager.h"
+#include <avr/interrupt.h>
+#include <string.h>
+
+/** Entry of the task table */
+typedef struct {
+	scheduler_task_t  task;    ///< Function to run
+	timebase_t        period;  ///< Ticks between releases
+	timebase_t        release; ///< Time of the pending release, deadline is release + period
+	scheduler_stats_t stats;   ///< Execution statistics
+} scheduler_entry_t;
+
+static scheduler_entry_t scheduler_tasks[SCHEDULER_TASK_MAX];
+
+static uint8_t scheduler_task_count;
+
+/**
+ * \brief Add a periodic task
+ *
+ * \param[in] task Function to run
+ * \param[in] period Ticks between releases, not 0
+ * \param[in] offset Ticks from now to the first release, spreads tasks of equal period
+ *
+ * \return Task id for SCHEDULER_GetStats(), -1 if the table is full or period is 0
+ */
+int8_t SCHEDULER_AddTask(scheduler_task_t task, timebase_t period, timebase_t offset)
+{
+	scheduler_entry_t *entry;
+
+	if ((scheduler_task_count >= SCHEDULER_TASK_MAX) || (period == 0)) {
+		return -1;
+	}
+
+	/* Releases are timed by TCA0, which stops in power-down */
+	if (scheduler_task_count == 0) {
+		POWER_Lock(POWER_MODE_POWER_DOWN);
+	}
+
+	entry = &scheduler_tasks[scheduler_task_count];
+	memset(entry, 0, sizeof(*entry));
+	entry->task    = task;
+	entry->period  = period;
+	entry->release = TIMEBASE_Now() + offset;
+
+	return scheduler_task_count++;
+}
+
+/**
+ * \brief Add a periodic task with the period in microseconds
+ *
+ * \param[in] task Function to run
+ * \param[in] period_us Microseconds between releases
+ *
+ * \return Task id, -1 on error
+ */
+int8_t SCHEDULER_AddTaskUs(scheduler_task_t task, uint32_t period_us)
+{
+	return SCHEDULER_AddTask(task, TIMEBASE_UsToTicks(period_us), 0);
+}
+
+/**
+ * \brief Wake-up at the next release
+ */
+ISR(TCA0_CMP0_vect)
+{
+	TCA0.SINGLE.INTCTRL &= ~TCA_SINGLE_CMP0_bm;
+	TCA0.SINGLE.INTFLAGS = TCA_SINGLE_CMP0_bm;
+}
+
+/**
+ * \brief Run one task and update its statistics and next release
+ *
+ * \param[in] entry The task, released at or before now
+ */
+static void SCHEDULER_Dispatch(scheduler_entry_t *entry)
+{
+	timebase_t release = entry->release;
+	timebase_t start   = TIMEBASE_Now();
+	timebase_t end;
+	timebase_t elapsed;
+
+	entry->task();
+
+	end     = TIMEBASE_Now();
+	elapsed = TIMEBASE_ELAPSED(start, end);
+
+	entry->stats.runs++;
+	entry->stats.total += elapsed;
+	entry->stats.last = elapsed;
+	if (elapsed > entry->stats.max) {
+		entry->stats.max = elapsed;
+	}
+
+	/* Finished after the deadline, the next release */
+	if (TIMEBASE_ELAPSED(release, end) > entry->period) {
+		entry->stats.overruns++;
+	}
+
+	/* Stay on the original grid, dropping releases that have already passed */
+	release += entry->period;
+	while ((int32_t)(end - release) >= 0) {
+		release += entry->period;
+		entry->stats.skipped++;
+	}
+	entry->release = release;
+}
+
+/**
+ * \brief Run the due task with the earliest deadline, or sleep until one is due
+ *
+ * Call from the main loop. Returns after one task has run or after a wake-up,
+ * which may also have been caused by any other interrupt.
+ *
+ * \return Nothing
+ */
+void SCHEDULER_RunOnce(void)
+{
+	scheduler_entry_t *due      = NULL;
+	int32_t            deadline = 0;
+	int32_t            wait     = INT32_MAX;
+	timebase_t         now;
+
+	cpu_irq_disable();
+	now = TIMEBASE_Now();
+
+	for (uint8_t i = 0; i < scheduler_task_count; i++) {
+		scheduler_entry_t *entry = &scheduler_tasks[i];
+		/* Ticks until release, negative once released */
+		int32_t            until = (int32_t)(entry->release - now);
+
+		if (until <= SCHEDULER_SLEEP_MARGIN) {
+			if ((due == NULL) || (until + (int32_t)entry->period < deadline)) {
+				due      = entry;
+				deadline = until + (int32_t)entry->period;
+			}
+		} else if (until < wait) {
+			wait = until;
+		}
+	}
+
+	if (due != NULL) {
+		cpu_irq_enable();
+		while ((int32_t)(due->release - TIMEBASE_Now()) > 0) {
+		}
+		SCHEDULER_Dispatch(due);
+		return;
+	}
+
+	if (wait <= 0xFFFF) {
+		TCA0.SINGLE.CMP0     = (uint16_t)(now + wait);
+		TCA0.SINGLE.INTFLAGS = TCA_SINGLE_CMP0_bm;
+		TCA0.SINGLE.INTCTRL |= TCA_SINGLE_CMP0_bm;
+	}
+
+	POWER_Sleep((wait == INT32_MAX) ? 0xFFFFFFFFUL : (timebase_t)wait);
+}
+
+/**
+ * \brief Run the scheduler forever
+ *
+ * \return Never
+ */
+void SCHEDULER_Run(void)
+{
+	while (1) {
+		SCHEDULER_RunOnce();
+	}
+}
+
+/**
+ * \brief Copy the statistics of a task
+ *
+ * \param[in] id Task id returned by SCHEDULER_AddTask()
+ * \param[out] stats The statistics
+ *
+ * \return false for an unknown id
+ */
+bool SCHEDULER_GetStats(int8_t id, scheduler_stats_t *stats)
+{
+	if ((id < 0) || (id >= scheduler_task_count)) {
+		return false;
+	}
+
+	*stats = scheduler_tasks[id].stats;
+
+	return true;
+}
+
+/**
+ * \brief Clear the statistics of all tasks
+ *
+ * \return Nothing
+ */
+void SCHEDULER_ResetStats(void)
+{
+	for (uint8_t i = 0; i < scheduler_task_count; i++) {
+		memset(&scheduler_tasks[i].stats, 0, sizeof(scheduler_tasks[i].stats));
+	}
+}
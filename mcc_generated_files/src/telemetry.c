@@ -0,0 +1,159 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#include "../include/telemetry.h"
+#include "../include/usart1.h"
+#include "../include/timebase.h"
+#include "../include/clock_manager.h"
+
+static uint16_t telemetry_sequence;
+
+static uint16_t telemetry_dropped;
+
+/**
+ * \brief Frame a record and queue it for USART1
+ *
+ * \param[in] type Record type, telemetry_type_t
+ * \param[in] body Record body
+ * \param[in] size Size of the body, up to TELEMETRY_BODY_MAX
+ *
+ * \return false if the frame was dropped
+ */
+bool TELEMETRY_Send(uint8_t type, const uint8_t *body, uint8_t size)
+{
+	uint8_t frame[TELEMETRY_FRAME_MAX];
+	uint8_t length;
+	uint8_t queued;
+
+	if (size > TELEMETRY_BODY_MAX) {
+		return false;
+	}
+
+	length = (uint8_t)TELEMETRY_BuildFrame(frame, type, telemetry_sequence++, TIMEBASE_Now(), body, size);
+
+	if ((USART1_TX_POLICY == USART1_POLICY_DROP) && (USART1_GetTxFree() < length)) {
+		telemetry_dropped++;
+		return false;
+	}
+
+	queued = USART1_WriteBuffer(frame, length);
+	while (queued < length) {
+		if (!USART1_Write(frame[queued++])) {
+			/* Blocking is impossible with interrupts disabled, the host
+			 * discards the truncated frame at the next delimiter */
+			telemetry_dropped++;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * \brief Send the result of a diagnostic test
+ *
+ * \param[in] test Test, telemetry_test_t
+ * \param[in] status Status value returned by the test
+ * \param[in] value Measured value, 0 if the test has none
+ *
+ * \return false if the frame was dropped
+ */
+bool TELEMETRY_SendDiag(uint8_t test, uint8_t status, int32_t value)
+{
+	uint8_t body[6];
+
+	body[0] = test;
+	body[1] = status;
+	TELEMETRY_Put32(&body[2], (uint32_t)value);
+
+	return TELEMETRY_Send(TELEMETRY_DIAG, body, sizeof(body));
+}
+
+/**
+ * \brief Send the time at which a boot stage completed
+ *
+ * The current clock frequency is sent along so the host can convert.
+ *
+ * \param[in] stage Application defined stage number
+ * \param[in] ticks Timebase ticks since TIMEBASE_Initialize()
+ *
+ * \return false if the frame was dropped
+ */
+bool TELEMETRY_SendBootTime(uint8_t stage, uint32_t ticks)
+{
+	uint8_t body[9];
+
+	body[0] = stage;
+	TELEMETRY_Put32(&body[1], ticks);
+	TELEMETRY_Put32(&body[5], CLOCK_GetFrequency());
+
+	return TELEMETRY_Send(TELEMETRY_BOOT_TIME, body, sizeof(body));
+}
+
+/**
+ * \brief Send the value of a counter
+ *
+ * \param[in] counter Counter, telemetry_counter_t
+ * \param[in] value Value
+ *
+ * \return false if the frame was dropped
+ */
+bool TELEMETRY_SendCounter(uint8_t counter, uint32_t value)
+{
+	uint8_t body[5];
+
+	body[0] = counter;
+	TELEMETRY_Put32(&body[1], value);
+
+	return TELEMETRY_Send(TELEMETRY_COUNTER, body, sizeof(body));
+}
+
+/**
+ * \brief Number of frames not sent
+ *
+ * \return The count, wrapping at 65536
+ */
+uint16_t TELEMETRY_GetDropCount(void)
+{
+	return telemetry_dropped;
+}
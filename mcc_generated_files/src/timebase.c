@@ -0,0 +1,160 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#include "../include/timebase.h"
+#include "../include/clock_manager.h"
+#include <avr/interrupt.h>
+
+/** Number of TCA0 overflows since TIMEBASE_Initialize() */
+static volatile uint32_t timebase_overflows;
+
+/** Incremented with every overflow, a one-byte read is atomic */
+static volatile uint8_t timebase_generation;
+
+/**
+ * \brief Start TCA0 as free-running counter
+ *
+ * \return Nothing
+ */
+void TIMEBASE_Initialize(void)
+{
+	timebase_overflows  = 0;
+	timebase_generation = 0;
+
+	TCA0.SINGLE.CTRLA   = 0;
+	TCA0.SINGLE.CTRLB   = TCA_SINGLE_WGMODE_NORMAL_gc;
+	TCA0.SINGLE.CNT     = 0;
+	TCA0.SINGLE.PER     = 0xFFFF;
+	TCA0.SINGLE.INTFLAGS = TCA_SINGLE_OVF_bm;
+	TCA0.SINGLE.INTCTRL = TCA_SINGLE_OVF_bm;
+
+	//CLKSEL DIV1; RUNSTDBY enabled; ENABLE enabled;
+	TCA0.SINGLE.CTRLA = TCA_SINGLE_CLKSEL_DIV1_gc | TCA_SINGLE_RUNSTDBY_bm | TCA_SINGLE_ENABLE_bm;
+}
+
+ISR(TCA0_OVF_vect)
+{
+	timebase_overflows++;
+	timebase_generation++;
+
+	TCA0.SINGLE.INTFLAGS = TCA_SINGLE_OVF_bm;
+}
+
+/**
+ * \brief Read overflow count and counter as one consistent pair
+ *
+ * \param[out] overflows Overflow count belonging to the returned counter value
+ *
+ * \return The counter value
+ */
+static inline uint16_t TIMEBASE_Read(uint32_t *overflows)
+{
+	uint8_t  generation;
+	uint16_t count;
+	bool     pending;
+
+	do {
+		generation = timebase_generation;
+		*overflows = timebase_overflows;
+		count      = TCA0.SINGLE.CNT;
+		pending    = TCA0.SINGLE.INTFLAGS & TCA_SINGLE_OVF_bm;
+	} while (generation != timebase_generation);
+
+	/* Only possible with interrupts disabled: the counter wrapped but the ISR has not run.
+	 * A large count was read before the wrap and already belongs to the old overflow count. */
+	if (pending && (count < 0x8000)) {
+		(*overflows)++;
+	}
+
+	return count;
+}
+
+/**
+ * \brief Current 32-bit timestamp in CLK_PER ticks
+ *
+ * \return The timestamp
+ */
+timebase_t TIMEBASE_Now(void)
+{
+	uint32_t overflows;
+	uint16_t count = TIMEBASE_Read(&overflows);
+
+	return ((timebase_t)overflows << 16) | count;
+}
+
+/**
+ * \brief Current 64-bit timestamp in CLK_PER ticks, 48 bits significant
+ *
+ * \return The timestamp
+ */
+uint64_t TIMEBASE_Now64(void)
+{
+	uint32_t overflows;
+	uint16_t count = TIMEBASE_Read(&overflows);
+
+	return ((uint64_t)overflows << 16) | count;
+}
+
+/**
+ * \brief Convert ticks at the current clock frequency to microseconds
+ *
+ * \param[in] ticks Number of CLK_PER ticks
+ *
+ * \return Microseconds, rounded down
+ */
+uint32_t TIMEBASE_TicksToUs(timebase_t ticks)
+{
+	return (uint32_t)(((uint64_t)ticks * 1000000UL) / CLOCK_GetFrequency());
+}
+
+/**
+ * \brief Convert microseconds to ticks at the current clock frequency
+ *
+ * \param[in] us Microseconds
+ *
+ * \return Ticks, rounded up so a wait is never shorter than requested
+ */
+timebase_t TIMEBASE_UsToTicks(uint32_t us)
+{
+	return (timebase_t)(((uint64_t)us * CLOCK_GetFrequency() + 999999UL) / 1000000UL);
+}
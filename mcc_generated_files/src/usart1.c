@@ -0,0 +1,316 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#define ASSERT_FILE_ID ASSERT_FILE_USART1
+
+#include "../include/usart1.h"
+#include "../include/clock_manager.h"
+#include "../include/power_manager.h"
+#include "../include/utils/ring_buffer.h"
+#include "../include/utils/atomic.h"
+#include "../include/utils/utils_assert.h"
+#include <avr/interrupt.h>
+
+RING_BUFFER_DECLARE(usart1_tx, uint8_t, USART1_TX_BUFFER_SIZE)
+RING_BUFFER_DECLARE(usart1_rx, uint8_t, USART1_RX_BUFFER_SIZE)
+
+/** Main produces, DRE interrupt consumes */
+static usart1_tx_t usart1_tx_buffer;
+
+/** RXC interrupt produces, main consumes */
+static usart1_rx_t usart1_rx_buffer;
+
+/** Bytes lost to a full buffer, only written by the side that drops */
+static volatile uint16_t usart1_tx_dropped;
+static volatile uint16_t usart1_rx_dropped;
+
+static int USART1_printCHAR(char character, FILE *stream);
+
+FILE USART1_stream = FDEV_SETUP_STREAM(USART1_printCHAR, NULL, _FDEV_SETUP_WRITE);
+
+/**
+ * \brief Recompute the baud register, clock manager consumer
+ *
+ * Normal mode, 16 samples per bit: BAUD = 64 * f / (16 * baud). BAUD must
+ * be at least 64, so below about 1.84 MHz at 115200 baud the receiver
+ * switches to double-speed mode, 8 samples per bit: BAUD = 64 * f / (8 *
+ * baud). A clock too slow or too fast even for that is a configuration
+ * error and fails a run-time assert.
+ *
+ * \param[in] frequency New peripheral clock frequency in Hz
+ */
+static void USART1_SetClock(uint32_t frequency)
+{
+	uint32_t baud   = (4 * frequency + USART1_BAUD_RATE / 2) / USART1_BAUD_RATE;
+	uint8_t  rxmode = USART_RXMODE_NORMAL_gc;
+
+	if (baud < 64) {
+		baud   = (8 * frequency + USART1_BAUD_RATE / 2) / USART1_BAUD_RATE;
+		rxmode = USART_RXMODE_CLK2X_gc;
+	}
+	RUNTIME_ASSERT((baud >= 64) && (baud <= 0xFFFF));
+
+	USART1.BAUD  = (uint16_t)baud;
+	USART1.CTRLB = (USART1.CTRLB & ~USART_RXMODE_gm) | rxmode;
+}
+
+/**
+ * \brief Initialize USART1 and bind stdout to it
+ *
+ * \return Initialization status.
+ * \retval 0 the USART init was successful
+ */
+int8_t USART1_Initialize(void)
+{
+	usart1_tx_dropped = 0;
+	usart1_rx_dropped = 0;
+
+	USART1_SetClock(CLOCK_GetFrequency());
+	CLOCK_RegisterConsumer(USART1_SetClock);
+
+	//CMODE Asynchronous; PMODE disabled; SBMODE 1-bit; CHSIZE 8-bit;
+	USART1.CTRLC = USART_CMODE_ASYNCHRONOUS_gc | USART_PMODE_DISABLED_gc | USART_CHSIZE_8BIT_gc;
+
+	//RXCIE enabled; DREIE disabled until data is queued;
+	USART1.CTRLA = USART_RXCIE_bm;
+
+	//RXEN enabled; TXEN enabled; RXMODE as USART1_SetClock() selected;
+	USART1.CTRLB = USART_RXEN_bm | USART_TXEN_bm | (USART1.CTRLB & USART_RXMODE_gm);
+
+	/* RXC never fires in standby, bytes arriving there would be lost */
+	POWER_Lock(POWER_MODE_STANDBY);
+
+	stdout = &USART1_stream;
+
+	return 0;
+}
+
+/**
+ * \brief Enable the DRE interrupt after queueing data
+ *
+ * The transmitter holds a standby lock from the first queued byte until
+ * the TXC interrupt reports the shift register empty.
+ */
+static inline void USART1_StartTx(void)
+{
+	/* With DREIE set, the DRE interrupt has not yet seen the buffer empty
+	 * and will send the new data before it stops */
+	if (!(USART1.CTRLA & USART_DREIE_bm)) {
+		ENTER_CRITICAL(T);
+		if (!(USART1.CTRLA & USART_TXCIE_bm)) {
+			POWER_Lock(POWER_MODE_STANDBY);
+		}
+		USART1.CTRLA = (USART1.CTRLA & ~USART_TXCIE_bm) | USART_DREIE_bm;
+		EXIT_CRITICAL(T);
+	}
+}
+
+ISR(USART1_DRE_vect)
+{
+	uint8_t data;
+
+	if (usart1_tx_Pop(&usart1_tx_buffer, &data)) {
+		USART1.STATUS  = USART_TXCIF_bm;
+		USART1.TXDATAL = data;
+	} else {
+		USART1.CTRLA = (USART1.CTRLA & ~USART_DREIE_bm) | USART_TXCIE_bm;
+	}
+}
+
+ISR(USART1_TXC_vect)
+{
+	USART1.STATUS = USART_TXCIF_bm;
+	USART1.CTRLA &= ~USART_TXCIE_bm;
+	POWER_Unlock(POWER_MODE_STANDBY);
+}
+
+ISR(USART1_RXC_vect)
+{
+	uint8_t data = USART1.RXDATAL;
+
+	if (!usart1_rx_Push(&usart1_rx_buffer, data)) {
+		usart1_rx_dropped++;
+	}
+}
+
+/**
+ * \brief Check for room in the transmit buffer
+ *
+ * \return true if USART1_Write() will not drop or wait
+ */
+bool USART1_IsTxReady(void)
+{
+	return usart1_tx_Free(&usart1_tx_buffer) != 0;
+}
+
+/**
+ * \brief Room left in the transmit buffer
+ *
+ * \return Number of bytes USART1_WriteBuffer() takes right now
+ */
+uint8_t USART1_GetTxFree(void)
+{
+	return usart1_tx_Free(&usart1_tx_buffer);
+}
+
+/**
+ * \brief Check that all queued bytes have left the shift register
+ *
+ * DREIE is set while queued data remains. The DRE interrupt then hands
+ * over to TXCIE, which the TXC interrupt clears once the last byte has
+ * been shifted out, so the transmitter is idle with both cleared.
+ *
+ * \return true if the transmitter is idle
+ */
+bool USART1_IsTxDone(void)
+{
+	return !(USART1.CTRLA & (USART_DREIE_bm | USART_TXCIE_bm));
+}
+
+/**
+ * \brief Queue one byte for transmission
+ *
+ * With USART1_POLICY_BLOCK this waits for the DRE interrupt to make room,
+ * except with interrupts disabled, where waiting would never end and the
+ * byte is dropped instead.
+ *
+ * \param[in] data Byte to send
+ *
+ * \return false if the byte was dropped
+ */
+bool USART1_Write(uint8_t data)
+{
+	while (!usart1_tx_Push(&usart1_tx_buffer, data)) {
+		if ((USART1_TX_POLICY == USART1_POLICY_DROP) || !(SREG & CPU_I_bm)) {
+			usart1_tx_dropped++;
+			return false;
+		}
+	}
+
+	USART1_StartTx();
+
+	return true;
+}
+
+/**
+ * \brief Queue as many bytes as fit, never waits
+ *
+ * \param[in] data Bytes to send
+ * \param[in] size Number of bytes
+ *
+ * \return Number of bytes queued, the rest is left to the caller
+ */
+uint8_t USART1_WriteBuffer(const uint8_t *data, uint8_t size)
+{
+	uint8_t queued = usart1_tx_PushBulk(&usart1_tx_buffer, data, size);
+
+	if (queued) {
+		USART1_StartTx();
+	}
+
+	return queued;
+}
+
+/**
+ * \brief Check for received data
+ *
+ * \return true if USART1_Read() returns a byte
+ */
+bool USART1_IsRxReady(void)
+{
+	return usart1_rx_Count(&usart1_rx_buffer) != 0;
+}
+
+/**
+ * \brief Take one received byte, never waits
+ *
+ * \param[out] data Received byte
+ *
+ * \return false if nothing was received
+ */
+bool USART1_Read(uint8_t *data)
+{
+	return usart1_rx_Pop(&usart1_rx_buffer, data);
+}
+
+/**
+ * \brief Number of bytes dropped by USART1_Write()
+ *
+ * \return The count, wrapping at 65536
+ */
+uint16_t USART1_GetTxDropCount(void)
+{
+	uint16_t dropped;
+
+	ENTER_CRITICAL(R);
+	dropped = usart1_tx_dropped;
+	EXIT_CRITICAL(R);
+
+	return dropped;
+}
+
+/**
+ * \brief Number of received bytes lost to a full receive buffer
+ *
+ * \return The count, wrapping at 65536
+ */
+uint16_t USART1_GetRxDropCount(void)
+{
+	uint16_t dropped;
+
+	/* Only the receive handler counts, so masking it is enough */
+	ENTER_CRITICAL_MASK(R, USART1.CTRLA, USART_RXCIE_bm);
+	dropped = usart1_rx_dropped;
+	EXIT_CRITICAL_MASK(R, USART1.CTRLA);
+
+	return dropped;
+}
+
+static int USART1_printCHAR(char character, FILE *stream)
+{
+	(void)stream;
+
+	USART1_Write((uint8_t)character);
+
+	return 0;
+}
@@ -0,0 +1,124 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#include "../include/utils/compiler.h"
+#include "../include/utils/utils_assert.h"
+#include "../include/ccp.h"
+
+/** Not cleared by the startup code, survives the watchdog reset */
+static volatile __persistent assert_record_t assert_record;
+
+/**
+ * \brief Check that the record was written by ASSERT_Fail()
+ *
+ * \return true for a valid record
+ */
+static inline bool ASSERT_RecordValid(void)
+{
+	return (assert_record.magic == ASSERT_RECORD_MAGIC) && ((uint16_t)(assert_record.check ^ assert_record.line) == 0xFFFF);
+}
+
+/**
+ * \brief Record a failed RUNTIME_ASSERT() and reset through the watchdog
+ *
+ * The program counter is the return address of this call, converted from
+ * words to bytes so it can be looked up in the map file directly. The
+ * shortest watchdog period is requested; a watchdog locked by fuse keeps
+ * its own period and resets when that expires.
+ *
+ * \param[in] file ASSERT_FILE_ID of the calling file
+ * \param[in] line Line of the failing assert
+ */
+void ASSERT_Fail(uint8_t file, uint16_t line)
+{
+	uint8_t count = 0;
+
+	cpu_irq_disable();
+
+	if (ASSERT_RecordValid()) {
+		count = assert_record.count;
+	}
+
+	assert_record.file  = file;
+	assert_record.line  = line;
+	assert_record.pc    = (uint32_t)(uintptr_t)__builtin_return_address(0) * 2;
+	assert_record.count = (count < 0xFF) ? count + 1 : count;
+	assert_record.check = (uint16_t)~line;
+	assert_record.magic = ASSERT_RECORD_MAGIC;
+
+	while (WDT.STATUS & WDT_SYNCBUSY_bm) {
+	}
+	CCP_WRITE_IO(WDT.CTRLA, WDT_PERIOD_8CLK_gc);
+
+	while (1) {
+	}
+}
+
+/**
+ * \brief Read the record of the last failed RUNTIME_ASSERT()
+ *
+ * \param[out] record Copy of the record
+ *
+ * \return false if no failure has been recorded since the record was cleared
+ */
+bool ASSERT_GetRecord(assert_record_t *record)
+{
+	if (!ASSERT_RecordValid()) {
+		return false;
+	}
+
+	*record = assert_record;
+
+	return true;
+}
+
+/**
+ * \brief Forget the recorded failure
+ *
+ * \return Nothing
+ */
+void ASSERT_ClearRecord(void)
+{
+	assert_record.magic = 0;
+	assert_record.count = 0;
+}
@@ -0,0 +1,317 @@
+/**
+  @Company
+    Microchip Technology Inc.
+
+  @Description
+    This Source file provides APIs.
+    Generation Information :
+    Driver Version    :   1.0.0
+*/
+/*
+Copyright (c) [2012-2020] Microchip Technology Inc.  
+
+    All rights reserved.
+
+    You are permitted to use the accompanying software and its derivatives 
+    with Microchip products. See the Microchip license agreement accompanying 
+    this software, if any, for additional info regarding your rights and 
+    obligations.
+    
+    MICROCHIP SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT 
+    WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+    LIMITATION, ANY WARRANTY OF MERCHANTABILITY, TITLE, NON-INFRINGEMENT 
+    AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP OR ITS
+    LICENSORS BE LIABLE OR OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT 
+    LIABILITY, CONTRIBUTION, BREACH OF WARRANTY, OR OTHER LEGAL EQUITABLE 
+    THEORY FOR ANY DIRECT OR INDIRECT DAMAGES OR EXPENSES INCLUDING BUT NOT 
+    LIMITED TO ANY INCIDENTAL, SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES, 
+    OR OTHER SIMILAR COSTS. 
+    
+    To the fullest extend allowed by law, Microchip and its licensors 
+    liability will not exceed the amount of fees, if any, that you paid 
+    directly to Microchip to use this software. 
+    
+    THIRD PARTY SOFTWARE:  Notwithstanding anything to the contrary, any 
+    third party software accompanying this software is subject to the terms 
+    and conditions of the third party's license agreement.  To the extent 
+    required by third party licenses covering such third party software, 
+    the terms of such license will apply in lieu of the terms provided in 
+    this notice or applicable license.  To the extent the terms of such 
+    third party licenses prohibit any of the restrictions described here, 
+    such restrictions will not apply to such third party software.
+*/
+
+#define ASSERT_FILE_ID ASSERT_FILE_WATCHDOG
+
+#include "../include/watchdog.h"
+#include "../include/ccp.h"
+#include "../include/clock_manager.h"
+#include "../include/scheduler.h"
+#include "../include/utils/atomic.h"
+#include "../include/utils/utils_assert.h"
+#include <avr/wdt.h>
+
+/** Check-in bits of the registered tasks */
+static uint8_t watchdog_registered;
+
+/** Check-in bits set since the last kick */
+static volatile uint8_t watchdog_checked_in;
+
+/** Time of the last kick in window mode */
+static timebase_t watchdog_last_kick;
+
+/** Longest closed window in microseconds, 0 in normal mode */
+static uint32_t watchdog_closed_us;
+
+/** Longest closed window in ticks at the current clock */
+static timebase_t watchdog_closed_ticks;
+
+/** Longest time between WATCHDOG_Poll() calls that cannot time out */
+static uint32_t watchdog_slice_limit_us;
+
+/** Shortest time from a kick to a reset, over the oscillator tolerance */
+static uint32_t watchdog_timeout_us;
+
+/** Longest time between two kicks in window mode since last taken */
+static timebase_t watchdog_max_gap;
+
+/**
+ * \brief Length of a WDT period or window setting
+ *
+ * \param[in] setting PERIOD or WINDOW field value, shifted down to bit 0
+ *
+ * \return WDT cycles, 0 for OFF
+ */
+static uint16_t WATCHDOG_Cycles(uint8_t setting)
+{
+	return setting ? (uint16_t)(4U << setting) : 0;
+}
+
+/**
+ * \brief WDT cycles to microseconds at the nominal 1.024 kHz
+ *
+ * \param[in] cycles WDT cycles
+ *
+ * \return Microseconds
+ */
+static uint32_t WATCHDOG_CyclesToUs(uint16_t cycles)
+{
+	return (uint32_t)cycles * 15625UL / 16U;
+}
+
+/**
+ * \brief Convert the closed window to ticks, clock manager consumer
+ *
+ * \param[in] frequency New peripheral clock frequency in Hz
+ */
+static void WATCHDOG_SetClock(uint32_t frequency)
+{
+	(void)frequency;
+
+	watchdog_closed_ticks = TIMEBASE_UsToTicks(watchdog_closed_us);
+}
+
+/**
+ * \brief Scheduler task running WATCHDOG_Service()
+ */
+static void WATCHDOG_ServiceTask(void)
+{
+	WATCHDOG_Service();
+}
+
+/**
+ * \brief Start the WDT in window mode and the service task
+ *
+ * Call after the timebase, clock manager and power manager are initialized.
+ *
+ * \return Nothing
+ */
+void WATCHDOG_Initialize(void)
+{
+	watchdog_registered = 0;
+	watchdog_checked_in = 0;
+
+	WATCHDOG_Enable(WATCHDOG_PERIOD, WATCHDOG_WINDOW);
+	CLOCK_RegisterConsumer(WATCHDOG_SetClock);
+	SCHEDULER_AddTaskUs(WATCHDOG_ServiceTask, WATCHDOG_SERVICE_PERIOD_US);
+}
+
+/**
+ * \brief Configure the WDT
+ *
+ * Kicks the running WDT before changing its configuration and waits for
+ * both to synchronize, which takes up to 6 ms. Also usable before main(),
+ * in normal mode only as the timebase is not running yet there. Has no
+ * effect if the WDT configuration is locked.
+ *
+ * \param[in] period WDT_PERIOD_ value, WDT_PERIOD_OFF_gc stops the WDT
+ * \param[in] window WDT_WINDOW_ value, WDT_WINDOW_OFF_gc for normal mode
+ *
+ * \return Nothing
+ */
+void WATCHDOG_Enable(uint8_t period, uint8_t window)
+{
+	uint16_t open_cycles   = WATCHDOG_Cycles((period & WDT_PERIOD_gm) >> WDT_PERIOD_gp);
+	uint16_t closed_cycles = WATCHDOG_Cycles((window & WDT_WINDOW_gm) >> WDT_WINDOW_gp);
+	uint32_t closed_min    = WATCHDOG_CyclesToUs(closed_cycles) * 100U / (100U + WATCHDOG_TOLERANCE_PERCENT);
+	uint32_t timeout_min   = WATCHDOG_CyclesToUs(closed_cycles + open_cycles) * 100U / (100U + WATCHDOG_TOLERANCE_PERCENT);
+
+	while (WDT.STATUS & WDT_SYNCBUSY_bm) {
+	}
+	wdt_reset();
+	while (WDT.STATUS & WDT_SYNCBUSY_bm) {
+	}
+	CCP_WRITE_IO(WDT.CTRLA, (period & WDT_PERIOD_gm) | (window & WDT_WINDOW_gm));
+	while (WDT.STATUS & WDT_SYNCBUSY_bm) {
+	}
+
+	watchdog_timeout_us = open_cycles ? timeout_min : UINT32_MAX;
+	watchdog_max_gap    = 0;
+
+	/* A poll at most one slice after the longest closed window must still be before the shortest timeout */
+	if (closed_cycles) {
+		watchdog_closed_us = WATCHDOG_CyclesToUs(closed_cycles + WATCHDOG_SYNC_CYCLES)
+		                     * (100U + WATCHDOG_TOLERANCE_PERCENT) / 100U;
+		watchdog_slice_limit_us = timeout_min - (watchdog_closed_us - closed_min);
+		watchdog_closed_ticks   = TIMEBASE_UsToTicks(watchdog_closed_us);
+		watchdog_last_kick      = TIMEBASE_Now();
+	} else {
+		watchdog_closed_us      = 0;
+		watchdog_slice_limit_us = open_cycles ? timeout_min - WATCHDOG_CyclesToUs(WATCHDOG_SYNC_CYCLES) : UINT32_MAX;
+	}
+}
+
+/**
+ * \brief Register a task that must check in before each kick
+ *
+ * \return Task id for WATCHDOG_CheckIn(), -1 if all are taken
+ */
+int8_t WATCHDOG_Register(void)
+{
+	int8_t id;
+
+	for (id = 0; id < WATCHDOG_TASK_MAX; id++) {
+		if (!(watchdog_registered & (1U << id))) {
+			ENTER_CRITICAL(R);
+			watchdog_registered |= 1U << id;
+			EXIT_CRITICAL(R);
+			return id;
+		}
+	}
+	return -1;
+}
+
+/**
+ * \brief Report a task alive, callable from ISRs
+ *
+ * \param[in] id Task id returned by WATCHDOG_Register()
+ */
+void WATCHDOG_CheckIn(int8_t id)
+{
+	RUNTIME_ASSERT((uint8_t)id < WATCHDOG_TASK_MAX);
+
+	ENTER_CRITICAL(C);
+	watchdog_checked_in |= 1U << id;
+	EXIT_CRITICAL(C);
+}
+
+/**
+ * \brief Kick the WDT if every registered task has checked in
+ *
+ * \return true if the WDT was kicked
+ */
+bool WATCHDOG_Service(void)
+{
+	uint8_t checked = watchdog_checked_in;
+
+	if ((checked & watchdog_registered) != watchdog_registered) {
+		return false;
+	}
+	if (!WATCHDOG_Poll()) {
+		return false;
+	}
+
+	/* Check-ins arriving meanwhile count for the next kick */
+	ENTER_CRITICAL(C);
+	watchdog_checked_in &= ~checked;
+	EXIT_CRITICAL(C);
+	return true;
+}
+
+/**
+ * \brief Kick the WDT if its closed window is over, ignoring check-ins
+ *
+ * For long operations that hold up the registered tasks. Call between
+ * slices no longer than WATCHDOG_GetSliceLimitUs() apart. In window mode
+ * interrupts must be on between slices: with them off the timebase misses
+ * overflows, the window never looks open and the WDT times out.
+ *
+ * \return true if the WDT was kicked
+ */
+bool WATCHDOG_Poll(void)
+{
+	timebase_t now;
+	timebase_t gap;
+
+	if (WDT.STATUS & WDT_SYNCBUSY_bm) {
+		return false;
+	}
+
+	if (WDT.CTRLA & WDT_WINDOW_gm) {
+		now = TIMEBASE_Now();
+		gap = TIMEBASE_ELAPSED(watchdog_last_kick, now);
+		if (gap < watchdog_closed_ticks) {
+			return false;
+		}
+		if (gap > watchdog_max_gap) {
+			watchdog_max_gap = gap;
+		}
+		watchdog_last_kick = now;
+	}
+
+	wdt_reset();
+	return true;
+}
+
+/**
+ * \brief Longest time between WATCHDOG_Poll() calls that cannot time out
+ *
+ * Worst case over the oscillator tolerance, for the configuration last set
+ * by WATCHDOG_Enable() after main() started.
+ *
+ * \return Microseconds
+ */
+uint32_t WATCHDOG_GetSliceLimitUs(void)
+{
+	return watchdog_slice_limit_us;
+}
+
+/**
+ * \brief Shortest time from a kick to a reset
+ *
+ * Worst case over the oscillator tolerance, for the configuration last set
+ * by WATCHDOG_Enable().
+ *
+ * \return Microseconds, UINT32_MAX with the WDT off
+ */
+uint32_t WATCHDOG_GetTimeoutUs(void)
+{
+	return watchdog_timeout_us;
+}
+
+/**
+ * \brief Longest time between two kicks, then start over
+ *
+ * Tracked in window mode only, from the timebase. Staying below
+ * WATCHDOG_GetTimeoutUs() over a run of the longest operations shows they
+ * cannot cause a timeout.
+ *
+ * \return Microseconds since the last call or WATCHDOG_Enable()
+ */
+uint32_t WATCHDOG_TakeMaxKickGapUs(void)
+{
+	timebase_t gap = watchdog_max_gap;
+
+	watchdog_max_gap = 0;
+	return TIMEBASE_TicksToUs(gap);
+}
@@ -0,0 +1,379 @@
+/**
+ *  Host-side decoder for the telemetry frames of telemetry_protocol.h.
+ *
+ *  Build:
+ *      cc -std=c99 -O2 -o telemetry_decode tools/telemetry_decode.c \
+ *         mcc_generated_files/src/cobs.c mcc_generated_files/src/crc.c
+ *
+ *  Usage:
+ *      telemetry_decode [--baud N] [PORT|FILE]   decode, stdin if no path given
+ *      telemetry_decode --loopback               encode/decode self test
+ *
+ *  One line per record is written to stdout. Frames failing COBS or CRC
+ *  checks and gaps in the sequence numbers are counted and summarized on
+ *  stderr at the end. Bytes between delimiters that are not frames, such as
+ *  FMT_ text sharing the line, are counted as bad frames and skipped.
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "../mcc_generated_files/include/telemetry_protocol.h"
+
+/** Longest run of bytes kept while looking for a delimiter */
+#define DECODE_BUFFER_MAX 512
+
+typedef struct {
+    uint8_t  buffer[DECODE_BUFFER_MAX];
+    size_t   length;
+    bool     overflow;
+    bool     have_sequence;
+    uint16_t next_sequence;
+    unsigned long frames;
+    unsigned long bad_frames;
+    unsigned long lost_frames;
+    FILE    *out;
+} decoder_t;
+
+static const char *decode_test_name(uint8_t test)
+{
+    switch (test) {
+    case TELEMETRY_TEST_SRAM_MARCHB:
+        return "SRAM_MARCHB";
+    case TELEMETRY_TEST_SRAM_CHECKERBOARD:
+        return "SRAM_CHECKERBOARD";
+    case TELEMETRY_TEST_FLASH_CRC:
+        return "FLASH_CRC";
+    case TELEMETRY_TEST_CLOCK:
+        return "CLOCK";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+static const char *decode_counter_name(uint8_t counter)
+{
+    switch (counter) {
+    case TELEMETRY_COUNTER_TX_DROPPED:
+        return "TX_DROPPED";
+    case TELEMETRY_COUNTER_RX_DROPPED:
+        return "RX_DROPPED";
+    case TELEMETRY_COUNTER_FRAMES_DROPPED:
+        return "FRAMES_DROPPED";
+    case TELEMETRY_COUNTER_EVENT_LOG:
+        return "EVENT_LOG";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+/** Print one verified payload, false if the body does not match its type */
+static bool decode_record(decoder_t *dec, const uint8_t *payload, size_t length)
+{
+    uint8_t        type      = payload[0];
+    uint16_t       sequence  = TELEMETRY_Get16(&payload[1]);
+    uint32_t       timestamp = TELEMETRY_Get32(&payload[3]);
+    const uint8_t *body      = &payload[TELEMETRY_HEADER_SIZE];
+    size_t         size      = length - TELEMETRY_HEADER_SIZE;
+
+    switch (type) {
+    case TELEMETRY_DIAG:
+        if (size != 6) {
+            return false;
+        }
+        fprintf(dec->out, "%5u %10lu DIAG test=%s status=%u value=%ld\n", sequence, (unsigned long)timestamp,
+                decode_test_name(body[0]), body[1], (long)(int32_t)TELEMETRY_Get32(&body[2]));
+        break;
+    case TELEMETRY_BOOT_TIME: {
+        uint32_t ticks;
+        uint32_t frequency;
+
+        if (size != 9) {
+            return false;
+        }
+        ticks     = TELEMETRY_Get32(&body[1]);
+        frequency = TELEMETRY_Get32(&body[5]);
+        fprintf(dec->out, "%5u %10lu BOOT_TIME stage=%u ticks=%lu us=%.1f\n", sequence, (unsigned long)timestamp,
+                body[0], (unsigned long)ticks, frequency ? ticks * 1e6 / frequency : 0.0);
+        break;
+    }
+    case TELEMETRY_COUNTER:
+        if (size != 5) {
+            return false;
+        }
+        fprintf(dec->out, "%5u %10lu COUNTER %s=%lu\n", sequence, (unsigned long)timestamp,
+                decode_counter_name(body[0]), (unsigned long)TELEMETRY_Get32(&body[1]));
+        break;
+    default:
+        fprintf(dec->out, "%5u %10lu TYPE_%u size=%zu\n", sequence, (unsigned long)timestamp, type, size);
+        break;
+    }
+
+    if (dec->have_sequence && (sequence != dec->next_sequence)) {
+        dec->lost_frames += (uint16_t)(sequence - dec->next_sequence);
+    }
+    dec->have_sequence = true;
+    dec->next_sequence = sequence + 1;
+
+    return true;
+}
+
+/** Check and print the bytes collected up to a delimiter */
+static void decode_frame(decoder_t *dec)
+{
+    uint8_t payload[DECODE_BUFFER_MAX];
+    size_t  length;
+
+    if (dec->length == 0) {
+        return;
+    }
+    if (dec->overflow) {
+        dec->bad_frames++;
+        return;
+    }
+
+    length = COBS_Decode(dec->buffer, dec->length, payload);
+    if ((length < TELEMETRY_HEADER_SIZE + TELEMETRY_CRC_SIZE)
+        || (CRC16_Update(CRC16_INITIAL, payload, length - TELEMETRY_CRC_SIZE)
+            != TELEMETRY_Get16(&payload[length - TELEMETRY_CRC_SIZE]))
+        || !decode_record(dec, payload, length - TELEMETRY_CRC_SIZE)) {
+        dec->bad_frames++;
+        return;
+    }
+
+    dec->frames++;
+}
+
+static void decode_byte(decoder_t *dec, uint8_t data)
+{
+    if (data == 0) {
+        decode_frame(dec);
+        dec->length   = 0;
+        dec->overflow = false;
+    } else if (dec->length < sizeof(dec->buffer)) {
+        dec->buffer[dec->length++] = data;
+    } else {
+        dec->overflow = true;
+    }
+}
+
+static void decode_summary(const decoder_t *dec)
+{
+    fprintf(stderr, "frames %lu, bad %lu, lost %lu\n", dec->frames, dec->bad_frames, dec->lost_frames);
+}
+
+static speed_t decode_speed(long baud)
+{
+    switch (baud) {
+    case 9600:
+        return B9600;
+    case 19200:
+        return B19200;
+    case 38400:
+        return B38400;
+    case 57600:
+        return B57600;
+    case 115200:
+        return B115200;
+    case 230400:
+        return B230400;
+    default:
+        return 0;
+    }
+}
+
+/** Put a serial port into raw mode, other files are left alone */
+static int decode_setup_port(int fd, long baud)
+{
+    struct termios tio;
+    speed_t        speed = decode_speed(baud);
+
+    if (!isatty(fd)) {
+        return 0;
+    }
+    if (speed == 0) {
+        fprintf(stderr, "unsupported baud rate %ld\n", baud);
+        return -1;
+    }
+    if (tcgetattr(fd, &tio) != 0) {
+        perror("tcgetattr");
+        return -1;
+    }
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, speed);
+    cfsetospeed(&tio, speed);
+    tio.c_cc[VMIN]  = 1;
+    tio.c_cc[VTIME] = 0;
+    if (tcsetattr(fd, TCSANOW, &tio) != 0) {
+        perror("tcsetattr");
+        return -1;
+    }
+
+    return 0;
+}
+
+/* Loopback: frames built with the firmware's own TELEMETRY_BuildFrame() */
+
+static size_t loopback_append(uint8_t *stream, size_t at, uint8_t type, uint16_t sequence, const uint8_t *body,
+                              uint8_t size)
+{
+    return at + TELEMETRY_BuildFrame(&stream[at], type, sequence, 1000u * sequence, body, size);
+}
+
+/** COBS round trip over zero-heavy and zero-free blocks of all lengths */
+static int loopback_cobs(void)
+{
+    static uint8_t block[1024];
+    static uint8_t encoded[COBS_ENCODED_MAX(sizeof(block))];
+    static uint8_t decoded[sizeof(encoded)];
+    int            failures = 0;
+
+    srand(1);
+    for (size_t size = 1; size < sizeof(block); size++) {
+        for (int pattern = 0; pattern < 3; pattern++) {
+            size_t length;
+
+            for (size_t i = 0; i < size; i++) {
+                block[i] = (pattern == 0) ? 0 : (pattern == 1) ? (uint8_t)(1 + i % 255) : (uint8_t)(rand() % 4);
+            }
+            length = COBS_Encode(block, size, encoded);
+            if ((length > COBS_ENCODED_MAX(size)) || memchr(encoded, 0, length)
+                || (COBS_Decode(encoded, length, decoded) != size) || memcmp(block, decoded, size)) {
+                fprintf(stderr, "COBS round trip failed, size %zu pattern %d\n", size, pattern);
+                failures++;
+            }
+        }
+    }
+
+    return failures;
+}
+
+/** Decode a stream with good, corrupted, foreign and missing frames */
+static int loopback_frames(void)
+{
+    static uint8_t stream[4096];
+    static const char text[] = "\r\nPassed : SRAM March-B test\r\n";
+    uint8_t        body[TELEMETRY_BODY_MAX];
+    size_t         at = 0;
+    size_t         corrupt_at;
+    decoder_t      dec;
+    int            failures = 0;
+
+    /* 0..3 good, all body bytes zero to exercise stuffing */
+    memset(body, 0, sizeof(body));
+    at = loopback_append(stream, at, TELEMETRY_DIAG, 0, body, 6);
+    body[0] = TELEMETRY_TEST_CLOCK;
+    TELEMETRY_Put32(&body[2], (uint32_t)-1234);
+    at = loopback_append(stream, at, TELEMETRY_DIAG, 1, body, 6);
+    body[0] = 1;
+    TELEMETRY_Put32(&body[1], 4000000u);
+    TELEMETRY_Put32(&body[5], 4000000u);
+    at = loopback_append(stream, at, TELEMETRY_BOOT_TIME, 2, body, 9);
+    body[0] = TELEMETRY_COUNTER_EVENT_LOG;
+    TELEMETRY_Put32(&body[1], 0xFFFFFFFFu);
+    at = loopback_append(stream, at, TELEMETRY_COUNTER, 3, body, 5);
+
+    /* Text sharing the line, without a zero byte like FMT_ output: one bad frame */
+    memcpy(&stream[at], text, sizeof(text) - 1);
+    at += sizeof(text) - 1;
+
+    /* 4 with a flipped bit: bad, and seen as lost */
+    corrupt_at = at;
+    at         = loopback_append(stream, at, TELEMETRY_COUNTER, 4, body, 5);
+    stream[corrupt_at + 4] ^= 0x10;
+
+    /* 5 and 6 never sent, 7 good */
+    at = loopback_append(stream, at, TELEMETRY_COUNTER, 7, body, 5);
+
+    /* 8 truncated: bad, and seen as lost */
+    corrupt_at = at;
+    at         = loopback_append(stream, at, TELEMETRY_COUNTER, 8, body, 5);
+    stream[corrupt_at + 5] = 0;
+    at                     = corrupt_at + 6;
+
+    /* 9 good, largest body */
+    memset(body, 0x5A, sizeof(body));
+    at = loopback_append(stream, at, 0x7F, 9, body, TELEMETRY_BODY_MAX);
+
+    memset(&dec, 0, sizeof(dec));
+    dec.out = stdout;
+    for (size_t i = 0; i < at; i++) {
+        decode_byte(&dec, stream[i]);
+    }
+    decode_summary(&dec);
+
+    if ((dec.frames != 6) || (dec.bad_frames != 3) || (dec.lost_frames != 4)) {
+        fprintf(stderr, "expected frames 6, bad 3, lost 4\n");
+        failures++;
+    }
+
+    return failures;
+}
+
+static int loopback(void)
+{
+    int failures = loopback_cobs() + loopback_frames();
+
+    fprintf(stderr, "loopback %s\n", failures ? "FAILED" : "passed");
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = NULL;
+    long        baud = 115200;
+    int         fd   = STDIN_FILENO;
+    decoder_t   dec;
+    uint8_t     chunk[256];
+    ssize_t     got;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--loopback")) {
+            return loopback();
+        } else if (!strcmp(argv[i], "--baud") && (i + 1 < argc)) {
+            baud = strtol(argv[++i], NULL, 10);
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: %s [--baud N] [PORT|FILE] | --loopback\n", argv[0]);
+            return EXIT_FAILURE;
+        } else {
+            path = argv[i];
+        }
+    }
+
+    if (path) {
+        fd = open(path, O_RDONLY | O_NOCTTY);
+        if (fd < 0) {
+            fprintf(stderr, "%s: %s\n", path, strerror(errno));
+            return EXIT_FAILURE;
+        }
+    }
+    if (decode_setup_port(fd, baud) != 0) {
+        return EXIT_FAILURE;
+    }
+
+    memset(&dec, 0, sizeof(dec));
+    dec.out = stdout;
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    while ((got = read(fd, chunk, sizeof(chunk))) > 0) {
+        for (ssize_t i = 0; i < got; i++) {
+            decode_byte(&dec, chunk[i]);
+        }
+    }
+    if (got < 0) {
+        perror("read");
+    }
+
+    decode_summary(&dec);
+
+    return EXIT_SUCCESS;
+}